@@ -83,3 +83,26 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Color parameter of a bound method, passed from JS as a Float32Array. SkColor
+ is a plain integer, so colors are unwrapped as SkColor4f to keep them apart
+ from numeric parameters.
+ */
+template <> struct JsiArgument<SkColor4f> {
+  using Holder = SkColor;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "color", index);
+    }
+    return RNSkia::JsiSkColor::fromValue(runtime, value);
+  }
+  static SkColor4f unwrap(Holder &holder) {
+    return SkColor4f::FromColor(holder);
+  }
+};
+
+} // namespace RNJsi
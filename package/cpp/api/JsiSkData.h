@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <stdexcept>
 #include <utility>
 
 #include <jsi/jsi.h>
@@ -10,6 +11,7 @@
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
 
+#include "SkData.h"
 #include "SkFont.h"
 #include "SkStream.h"
 
@@ -19,6 +21,33 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
+// Array buffers backed by native memory were added to JSI in React Native 0.74
+#if defined(REACT_NATIVE_MINOR_VERSION) && REACT_NATIVE_MINOR_VERSION >= 74
+#define RNSKIA_JSI_MUTABLE_BUFFER 1
+#else
+#define RNSKIA_JSI_MUTABLE_BUFFER 0
+#endif
+
+#if RNSKIA_JSI_MUTABLE_BUFFER
+/**
+ Exposes the bytes of an SkData to JS without copying them. The SkData is kept
+ alive for as long as the runtime holds on to the buffer.
+ */
+class SkDataMutableBuffer : public jsi::MutableBuffer {
+public:
+  explicit SkDataMutableBuffer(sk_sp<SkData> data) : _data(std::move(data)) {}
+
+  size_t size() const override { return _data->size(); }
+
+  uint8_t *data() override {
+    return const_cast<uint8_t *>(_data->bytes()); // NOLINT
+  }
+
+private:
+  sk_sp<SkData> _data;
+};
+#endif
+
 class JsiSkData : public JsiSkWrappingSkPtrHostObject<SkData> {
 public:
   JsiSkData(std::shared_ptr<RNSkPlatformContext> context, sk_sp<SkData> asset)
@@ -43,5 +72,46 @@ public:
   static sk_sp<SkData> fromValue(jsi::Runtime &runtime, const jsi::Value &obj) {
     return obj.asObject(runtime).asHostObject<JsiSkData>(runtime)->getObject();
   }
+
+  /**
+   Returns a Uint8Array with the contents of the data, or null if there is no
+   data. The array is backed directly by the SkData when JSI and the runtime
+   support external array buffers, otherwise the bytes are copied.
+   */
+  static jsi::Value toUint8Array(jsi::Runtime &runtime, sk_sp<SkData> data) {
+    if (data == nullptr) {
+      return jsi::Value::null();
+    }
+    auto arrayCtor =
+        runtime.global().getPropertyAsFunction(runtime, "Uint8Array");
+#if RNSKIA_JSI_MUTABLE_BUFFER
+    // JS may write to the array, so never hand out an SkData shared with
+    // someone else.
+    if (!data->unique()) {
+      data = SkData::MakeWithCopy(data->data(), data->size());
+    }
+    try {
+      jsi::ArrayBuffer buffer(runtime,
+                              std::make_shared<SkDataMutableBuffer>(data));
+      return arrayCtor.callAsConstructor(runtime, buffer).getObject(runtime);
+    } catch (const std::logic_error &) {
+      // Runtimes without support for external array buffers throws a logic
+      // error, fall back to copying.
+    }
+#endif
+
+    size_t size = data->size();
+    jsi::Object array =
+        arrayCtor.callAsConstructor(runtime, static_cast<double>(size))
+            .getObject(runtime);
+    jsi::ArrayBuffer buffer =
+        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
+            .asObject(runtime)
+            .getArrayBuffer(runtime);
+
+    auto bfrPtr = reinterpret_cast<uint8_t *>(buffer.data(runtime));
+    memcpy(bfrPtr, data->bytes(), size);
+    return array;
+  }
 };
 } // namespace RNSkia
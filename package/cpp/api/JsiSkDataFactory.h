@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
 
 #include <ReactCommon/TurboModuleUtils.h>
@@ -9,6 +11,7 @@
 #include "SkBase64.h"
 
 #include "JsiSkData.h"
+#include "RuntimeLifecycleMonitor.h"
 
 namespace RNSkia {
 
@@ -61,6 +64,45 @@ public:
         runtime, std::make_shared<JsiSkData>(getContext(), std::move(data)));
   }
 
+  /**
+   Wraps the memory of a Uint8Array in an SkData without copying it. The JS
+   buffer is kept alive until the SkData is released or the runtime is
+   destroyed, and must not be modified while the data or anything created from
+   it is in use. The data must not be used once the runtime is destroyed.
+   */
+  JSI_HOST_FUNCTION(fromBytesNoCopy) {
+    auto array = arguments[0].asObject(runtime);
+    auto buffer =
+        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
+            .asObject(runtime)
+            .getArrayBuffer(runtime);
+    auto byteOffset = static_cast<size_t>(
+        array.getProperty(runtime, "byteOffset").asNumber());
+    auto byteLength = static_cast<size_t>(
+        array.getProperty(runtime, "byteLength").asNumber());
+    if (byteOffset + byteLength > buffer.size(runtime)) {
+      throw jsi::JSError(runtime, "Invalid byte range in fromBytesNoCopy.");
+    }
+
+    auto bytes = buffer.data(runtime) + byteOffset;
+    auto releaseContext = NoCopyReleaseContext::make(runtime, getContext(),
+                                                     std::move(buffer));
+    auto data = SkData::MakeWithProc(
+        bytes, byteLength,
+        [](const void *, void *ctx) {
+          // The SkData can be released from any thread
+          auto holder =
+              static_cast<std::shared_ptr<NoCopyReleaseContext> *>(ctx);
+          auto releaseContext = std::move(*holder);
+          delete holder;
+          releaseContext->release();
+        },
+        new std::shared_ptr<NoCopyReleaseContext>(std::move(releaseContext)));
+
+    return jsi::Object::createFromHostObject(
+        runtime, std::make_shared<JsiSkData>(getContext(), std::move(data)));
+  }
+
   JSI_HOST_FUNCTION(fromBase64) {
     auto base64 = arguments[0].asString(runtime);
     auto base64Str = base64.utf8(runtime);
@@ -90,10 +132,82 @@ public:
 
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkDataFactory, fromURI),
                        JSI_EXPORT_FUNC(JsiSkDataFactory, fromBytes),
+                       JSI_EXPORT_FUNC(JsiSkDataFactory, fromBytesNoCopy),
                        JSI_EXPORT_FUNC(JsiSkDataFactory, fromBase64))
 
   explicit JsiSkDataFactory(std::shared_ptr<RNSkPlatformContext> context)
       : JsiSkHostObject(std::move(context)) {}
+
+private:
+  /**
+   Holds on to the JS buffer wrapped by an SkData. The buffer is released on
+   the Javascript thread once the SkData is released, or dropped when the
+   runtime is destroyed, whichever comes first.
+   */
+  class NoCopyReleaseContext
+      : public RNJsi::RuntimeLifecycleListener,
+        public std::enable_shared_from_this<NoCopyReleaseContext> {
+  public:
+    static std::shared_ptr<NoCopyReleaseContext>
+    make(jsi::Runtime &runtime, std::shared_ptr<RNSkPlatformContext> context,
+         jsi::ArrayBuffer buffer) {
+      auto releaseContext = std::shared_ptr<NoCopyReleaseContext>(
+          new NoCopyReleaseContext(runtime, std::move(context),
+                                   std::move(buffer)));
+      // Kept alive while registered with the lifecycle monitor
+      releaseContext->_self = releaseContext;
+      RNJsi::RuntimeLifecycleMonitor::addListener(runtime,
+                                                  releaseContext.get());
+      return releaseContext;
+    }
+
+    /**
+     Called when the SkData is released. The JS buffer may only be released
+     on the Javascript thread.
+     */
+    void release() {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_runtime == nullptr) {
+        return;
+      }
+      // If the task never runs the buffer is dropped with the runtime
+      _context->runOnJavascriptThread(
+          [self = shared_from_this()]() { self->releaseOnJavascriptThread(); });
+    }
+
+    void onRuntimeDestroyed(jsi::Runtime *) override {
+      std::shared_ptr<NoCopyReleaseContext> self;
+      std::lock_guard<std::mutex> lock(_mutex);
+      _buffer.reset();
+      _runtime = nullptr;
+      self = std::move(_self);
+    }
+
+  private:
+    NoCopyReleaseContext(jsi::Runtime &runtime,
+                         std::shared_ptr<RNSkPlatformContext> context,
+                         jsi::ArrayBuffer buffer)
+        : _runtime(&runtime), _context(std::move(context)),
+          _buffer(std::move(buffer)) {}
+
+    void releaseOnJavascriptThread() {
+      std::shared_ptr<NoCopyReleaseContext> self;
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_runtime != nullptr) {
+        RNJsi::RuntimeLifecycleMonitor::removeListener(*_runtime, this);
+        _buffer.reset();
+        _runtime = nullptr;
+      }
+      self = std::move(_self);
+    }
+
+    std::mutex _mutex;
+    // Null once the buffer has been released or the runtime destroyed
+    jsi::Runtime *_runtime;
+    std::shared_ptr<RNSkPlatformContext> _context;
+    std::optional<jsi::ArrayBuffer> _buffer;
+    std::shared_ptr<NoCopyReleaseContext> _self;
+  };
 };
 
 } // namespace RNSkia
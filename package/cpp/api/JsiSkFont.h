@@ -26,7 +26,8 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
-class JsiSkFont : public JsiSkWrappingSharedPtrHostObject<SkFont> {
+class JsiSkFont : public JsiSkWrappingSharedPtrHostObject<SkFont>,
+                  public JsiSkMutableHostObject {
 public:
   // TODO: declare in JsiSkWrappingSkPtrHostObject via extra template parameter?
   JSI_PROPERTY_GET(__typename__) {
@@ -185,54 +186,63 @@ public:
   JSI_HOST_FUNCTION(setEdging) {
     auto edging = arguments[0].asNumber();
     getObject()->setEdging(static_cast<SkFont::Edging>(edging));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(embeddedBitmaps) {
     auto embeddedBitmaps = arguments[0].getBool();
     getObject()->setEmbeddedBitmaps(embeddedBitmaps);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setHinting) {
     auto hinting = arguments[0].asNumber();
     getObject()->setHinting(static_cast<SkFontHinting>(hinting));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setLinearMetrics) {
     auto linearMetrics = arguments[0].getBool();
     getObject()->setLinearMetrics(linearMetrics);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setScaleX) {
     auto scaleX = arguments[0].asNumber();
     getObject()->setScaleX(scaleX);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setSkewX) {
     auto skewX = arguments[0].asNumber();
     getObject()->setSkewX(skewX);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setSize) {
     auto size = arguments[0].asNumber();
     getObject()->setSize(size);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setEmbolden) {
     auto embolden = arguments[0].asNumber();
     getObject()->setEmbolden(embolden);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setSubpixel) {
     auto subpixel = arguments[0].asNumber();
     getObject()->setSubpixel(subpixel);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -241,6 +251,7 @@ public:
                         ? nullptr
                         : JsiSkTypeface::fromValue(runtime, arguments[0]);
     getObject()->setTypeface(typeface);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -308,3 +319,17 @@ public:
 };
 
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Font parameter of a bound method
+ */
+template <>
+struct JsiArgument<const SkFont &> : JsiHostObjectArgument<RNSkia::JsiSkFont> {
+  static const SkFont &unwrap(Holder &holder) {
+    return *holder.object->getObject();
+  }
+};
+
+} // namespace RNJsi
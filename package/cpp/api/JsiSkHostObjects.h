@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -77,6 +78,44 @@ public:
                                                     std::move(object)) {}
 };
 
+/**
+ * Base class for host objects wrapping an object that JS changes in place,
+ * like paths and paints. Nodes holding such an object in their props compare
+ * its generation to find the changes that didn't go through setProps.
+ */
+class JsiSkMutableHostObject {
+public:
+  virtual ~JsiSkMutableHostObject() = default;
+
+  /**
+   * @return A number that changes every time the object is changed in place
+   */
+  size_t getGeneration() const {
+    return _generation.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @return A number that changes every time any of these objects is changed
+   * in place, so that nothing needs to be compared while it stays the same
+   */
+  static size_t getMutationCount() {
+    return _mutationCount.load(std::memory_order_acquire);
+  }
+
+protected:
+  /**
+   * Called by the methods changing the wrapped object, once it has changed
+   */
+  void markChanged() {
+    _generation.fetch_add(1, std::memory_order_release);
+    _mutationCount.fetch_add(1, std::memory_order_release);
+  }
+
+private:
+  std::atomic<size_t> _generation = {0};
+  static inline std::atomic<size_t> _mutationCount = {0};
+};
+
 template <typename T>
 class JsiSkWrappingSkPtrHostObject : public JsiSkWrappingHostObject<sk_sp<T>> {
 public:
@@ -4,6 +4,7 @@
 #include <string>
 #include <utility>
 
+#include "JsiSkData.h"
 #include "JsiSkMatrix.h"
 #include "JsiSkShader.h"
 #include <JsiSkHostObjects.h>
@@ -71,21 +72,7 @@ public:
 
     // Get data
     auto data = getObject()->encodeToData(format, quality);
-    auto arrayCtor =
-        runtime.global().getPropertyAsFunction(runtime, "Uint8Array");
-    size_t size = data->size();
-
-    jsi::Object array =
-        arrayCtor.callAsConstructor(runtime, static_cast<double>(size))
-            .getObject(runtime);
-    jsi::ArrayBuffer buffer =
-        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
-            .asObject(runtime)
-            .getArrayBuffer(runtime);
-
-    auto bfrPtr = reinterpret_cast<uint8_t *>(buffer.data(runtime));
-    memcpy(bfrPtr, data->bytes(), size);
-    return array;
+    return JsiSkData::toUint8Array(runtime, std::move(data));
   }
 
   JSI_HOST_FUNCTION(encodeToBase64) {
@@ -139,3 +126,18 @@ public:
 };
 
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Image parameter of a bound method. Null if the image has been disposed.
+ */
+template <>
+struct JsiArgument<const SkImage *>
+    : JsiHostObjectArgument<RNSkia::JsiSkImage> {
+  static const SkImage *unwrap(Holder &holder) {
+    return holder.object->getObject().get();
+  }
+};
+
+} // namespace RNJsi
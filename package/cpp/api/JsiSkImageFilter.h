@@ -45,3 +45,19 @@ public:
 };
 
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Optional image filter parameter of a bound method, null when not provided
+ */
+template <>
+struct JsiArgument<const SkImageFilter *>
+    : JsiHostObjectArgument<RNSkia::JsiSkImageFilter, true> {
+  static const SkImageFilter *unwrap(Holder &holder) {
+    return holder.object != nullptr ? holder.object->getObject().get()
+                                    : nullptr;
+  }
+};
+
+} // namespace RNJsi
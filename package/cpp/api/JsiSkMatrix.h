@@ -18,7 +18,8 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
-class JsiSkMatrix : public JsiSkWrappingSharedPtrHostObject<SkMatrix> {
+class JsiSkMatrix : public JsiSkWrappingSharedPtrHostObject<SkMatrix>,
+                    public JsiSkMutableHostObject {
 public:
   JsiSkMatrix(std::shared_ptr<RNSkPlatformContext> context, SkMatrix m)
       : JsiSkWrappingSharedPtrHostObject<SkMatrix>(
@@ -47,6 +48,7 @@ public:
   JSI_HOST_FUNCTION(concat) {
     auto m3 = JsiSkMatrix::fromValue(runtime, arguments[0]);
     getObject()->preConcat(*m3);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -54,6 +56,7 @@ public:
     auto x = arguments[0].asNumber();
     auto y = arguments[1].asNumber();
     getObject()->preTranslate(x, y);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -61,6 +64,7 @@ public:
     auto x = arguments[0].asNumber();
     auto y = count > 1 ? arguments[1].asNumber() : 1;
     getObject()->preScale(x, y);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -68,17 +72,20 @@ public:
     auto x = arguments[0].asNumber();
     auto y = arguments[1].asNumber();
     getObject()->preSkew(x, y);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(rotate) {
     auto a = arguments[0].asNumber();
     getObject()->preRotate(SkRadiansToDegrees(a));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(identity) {
     getObject()->setIdentity();
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -128,3 +135,23 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Matrix parameter of a bound method, either a Matrix host object or an
+ array of nine numbers.
+ */
+template <> struct JsiArgument<const SkMatrix &> {
+  using Holder = std::shared_ptr<SkMatrix>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "object", index);
+    }
+    return RNSkia::JsiSkMatrix::fromValue(runtime, value);
+  }
+  static const SkMatrix &unwrap(Holder &holder) { return *holder; }
+};
+
+} // namespace RNJsi
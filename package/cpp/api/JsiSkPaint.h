@@ -23,7 +23,8 @@
 namespace RNSkia {
 namespace jsi = facebook::jsi;
 
-class JsiSkPaint : public JsiSkWrappingSharedPtrHostObject<SkPaint> {
+class JsiSkPaint : public JsiSkWrappingSharedPtrHostObject<SkPaint>,
+                   public JsiSkMutableHostObject {
 public:
   // TODO: declare in JsiSkWrappingSkPtrHostObject via extra template parameter?
   JSI_PROPERTY_GET(__typename__) {
@@ -40,6 +41,7 @@ public:
 
   JSI_HOST_FUNCTION(reset) {
     getObject()->reset();
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -71,54 +73,63 @@ public:
   JSI_HOST_FUNCTION(setColor) {
     SkColor color = JsiSkColor::fromValue(runtime, arguments[0]);
     getObject()->setColor(color);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setAlphaf) {
     SkScalar alpha = arguments[0].asNumber();
     getObject()->setAlphaf(alpha);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setAntiAlias) {
     bool antiAliased = arguments[0].getBool();
     getObject()->setAntiAlias(antiAliased);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setStrokeWidth) {
     SkScalar width = arguments[0].asNumber();
     getObject()->setStrokeWidth(width);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setStyle) {
     auto style = arguments[0].asNumber();
     getObject()->setStyle(static_cast<SkPaint::Style>(style));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setStrokeCap) {
     auto cap = arguments[0].asNumber();
     getObject()->setStrokeCap(static_cast<SkPaint::Cap>(cap));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setStrokeJoin) {
     int join = arguments[0].asNumber();
     getObject()->setStrokeJoin(static_cast<SkPaint::Join>(join));
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setStrokeMiter) {
     int limit = arguments[0].asNumber();
     getObject()->setStrokeMiter(limit);
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setBlendMode) {
     auto blendMode = (SkBlendMode)arguments[0].asNumber();
     getObject()->setBlendMode(blendMode);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -127,6 +138,7 @@ public:
                           ? nullptr
                           : JsiSkMaskFilter::fromValue(runtime, arguments[0]);
     getObject()->setMaskFilter(std::move(maskFilter));
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -135,6 +147,7 @@ public:
                            ? nullptr
                            : JsiSkImageFilter::fromValue(runtime, arguments[0]);
     getObject()->setImageFilter(std::move(imageFilter));
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -143,6 +156,7 @@ public:
                            ? nullptr
                            : JsiSkColorFilter::fromValue(runtime, arguments[0]);
     getObject()->setColorFilter(std::move(colorFilter));
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -151,6 +165,7 @@ public:
                       ? nullptr
                       : JsiSkShader::fromValue(runtime, arguments[0]);
     getObject()->setShader(std::move(shader));
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -159,6 +174,7 @@ public:
                           ? nullptr
                           : JsiSkPathEffect::fromValue(runtime, arguments[0]);
     getObject()->setPathEffect(std::move(pathEffect));
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -194,6 +210,7 @@ public:
    */
   void fromPaint(const SkPaint &paint) {
     setObject(std::make_shared<SkPaint>(std::move(paint)));
+    markChanged();
   }
 
   /**
@@ -223,3 +240,31 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Paint parameter of a bound method. The paint is used in place, without
+ copying the shared pointer it is stored in.
+ */
+template <>
+struct JsiArgument<const SkPaint &>
+    : JsiHostObjectArgument<RNSkia::JsiSkPaint> {
+  static const SkPaint &unwrap(Holder &holder) {
+    return *holder.object->getObject();
+  }
+};
+
+/**
+ Optional paint parameter of a bound method, null when not provided
+ */
+template <>
+struct JsiArgument<const SkPaint *>
+    : JsiHostObjectArgument<RNSkia::JsiSkPaint, true> {
+  static const SkPaint *unwrap(Holder &holder) {
+    return holder.object != nullptr ? holder.object->getObject().get()
+                                    : nullptr;
+  }
+};
+
+} // namespace RNJsi
@@ -33,7 +33,8 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
-class JsiSkPath : public JsiSkWrappingSharedPtrHostObject<SkPath> {
+class JsiSkPath : public JsiSkWrappingSharedPtrHostObject<SkPath>,
+                  public JsiSkMutableHostObject {
 
 public:
   // TODO: declare in JsiSkWrappingSkPtrHostObject via extra template parameter?
@@ -55,6 +56,7 @@ public:
     } else {
       getObject()->addPath(*src, *matrix, mode);
     }
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -63,6 +65,7 @@ public:
     auto start = arguments[1].asNumber();
     auto sweep = arguments[2].asNumber();
     getObject()->addArc(*rect, start, sweep);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -74,6 +77,7 @@ public:
     }
     unsigned startIndex = count < 3 ? 0 : arguments[2].asNumber();
     auto result = getObject()->addOval(*rect, direction, startIndex);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -89,6 +93,7 @@ public:
       points.push_back(*point.get());
     }
     getObject()->addPoly(points.data(), static_cast<int>(points.size()), close);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -99,6 +104,7 @@ public:
       direction = SkPathDirection::kCCW;
     }
     getObject()->addRect(*rect, direction);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -109,6 +115,7 @@ public:
       direction = SkPathDirection::kCCW;
     }
     getObject()->addRRect(*rrect, direction);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -118,6 +125,7 @@ public:
     auto sweep = arguments[2].asNumber();
     auto forceMoveTo = arguments[3].getBool();
     getObject()->arcTo(*rect, start, sweep, forceMoveTo);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -133,6 +141,7 @@ public:
     auto x = arguments[5].asNumber();
     auto y = arguments[6].asNumber();
     getObject()->arcTo(rx, ry, xAxisRotate, arcSize, sweep, x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -148,6 +157,7 @@ public:
     auto x = arguments[5].asNumber();
     auto y = arguments[6].asNumber();
     getObject()->rArcTo(rx, ry, xAxisRotate, arcSize, sweep, x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -158,6 +168,7 @@ public:
     auto y2 = arguments[3].asNumber();
     auto r = arguments[4].asNumber();
     getObject()->arcTo(x1, y1, x2, y2, r);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -181,6 +192,7 @@ public:
     auto y2 = arguments[3].asNumber();
     auto w = arguments[4].asNumber();
     getObject()->conicTo(x1, y1, x2, y2, w);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -191,6 +203,7 @@ public:
     auto y2 = arguments[3].asNumber();
     auto w = arguments[4].asNumber();
     getObject()->rConicTo(x1, y1, x2, y2, w);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -215,9 +228,11 @@ public:
     // TODO: why we don't need to swap here? In trim() which is the same
     // API, we need to swap
     if (pe->filterPath(&path, path, &rec, nullptr)) {
+      markChanged();
       return jsi::Value(true);
     }
     SkDebugf("Could not make dashed path\n");
+    markChanged();
     return jsi::Value(false);
   }
 
@@ -237,6 +252,7 @@ public:
   JSI_HOST_FUNCTION(setFillType) {
     auto ft = (SkPathFillType)arguments[0].asNumber();
     getObject()->setFillType(ft);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -254,6 +270,7 @@ public:
   JSI_HOST_FUNCTION(transform) {
     auto m3 = *JsiSkMatrix::fromValue(runtime, arguments[0]);
     getObject()->transform(m3);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -291,6 +308,7 @@ public:
     auto precision = jsiPrecision.isUndefined() ? 1 : jsiPrecision.asNumber();
     auto result = p.getFillPath(path, &path, nullptr, precision);
     getObject()->swap(path);
+    markChanged();
     return result ? thisValue.getObject(runtime) : jsi::Value::null();
   }
 
@@ -310,6 +328,7 @@ public:
     SkStrokeRec rec(SkStrokeRec::InitStyle::kHairline_InitStyle);
     if (pe->filterPath(&path, path, &rec, nullptr)) {
       getObject()->swap(path);
+      markChanged();
       return thisValue.getObject(runtime);
     }
     SkDebugf("Could not trim path\n");
@@ -334,6 +353,7 @@ public:
     SkPath out;
     if (AsWinding(*getObject(), &out)) {
       getObject()->swap(out);
+      markChanged();
       return thisValue.getObject(runtime);
     }
     return jsi::Value::null();
@@ -345,6 +365,7 @@ public:
     SkScalar dx = arguments[0].asNumber();
     SkScalar dy = arguments[1].asNumber();
     getObject()->offset(dx, dy);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -352,6 +373,7 @@ public:
     SkScalar x = arguments[0].asNumber();
     SkScalar y = arguments[1].asNumber();
     getObject()->moveTo(x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -359,12 +381,14 @@ public:
     SkScalar x = arguments[0].asNumber();
     SkScalar y = arguments[1].asNumber();
     getObject()->rMoveTo(x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
   JSI_HOST_FUNCTION(lineTo) {
     SkScalar x = arguments[0].asNumber();
     SkScalar y = arguments[1].asNumber();
     getObject()->lineTo(x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -372,6 +396,7 @@ public:
     SkScalar x = arguments[0].asNumber();
     SkScalar y = arguments[1].asNumber();
     getObject()->rLineTo(x, y);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -383,6 +408,7 @@ public:
     auto x3 = arguments[4].asNumber();
     auto y3 = arguments[5].asNumber();
     getObject()->cubicTo(x1, y1, x2, y2, x3, y3);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -394,16 +420,19 @@ public:
     auto x3 = arguments[4].asNumber();
     auto y3 = arguments[5].asNumber();
     getObject()->rCubicTo(x1, y1, x2, y2, x3, y3);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
   JSI_HOST_FUNCTION(reset) {
     getObject()->reset();
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(rewind) {
     getObject()->rewind();
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -413,6 +442,7 @@ public:
     auto x2 = arguments[2].asNumber();
     auto y2 = arguments[3].asNumber();
     getObject()->quadTo(x1, y1, x2, y2);
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -422,6 +452,7 @@ public:
     auto x2 = arguments[2].asNumber();
     auto y2 = arguments[3].asNumber();
     getObject()->rQuadTo(x1, y1, x2, y2);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -430,6 +461,7 @@ public:
     auto y = arguments[1].asNumber();
     auto r = arguments[2].asNumber();
     getObject()->addCircle(x, y, r);
+    markChanged();
     return thisValue.getObject(runtime);
   }
 
@@ -444,6 +476,7 @@ public:
 
   JSI_HOST_FUNCTION(close) {
     getObject()->close();
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -451,6 +484,7 @@ public:
     SkPath result;
     if (Simplify(*getObject(), &result)) {
       getObject()->swap(result);
+      markChanged();
       return jsi::Value(true);
     }
     return jsi::Value(false);
@@ -473,6 +507,7 @@ public:
     SkPath result;
     if (Op(*getObject(), *path2, SkPathOp(pathOp), &result)) {
       getObject()->swap(result);
+      markChanged();
       return jsi::Value(true);
     }
     return jsi::Value(false);
@@ -593,3 +628,17 @@ public:
 };
 
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Path parameter of a bound method
+ */
+template <>
+struct JsiArgument<const SkPath &> : JsiHostObjectArgument<RNSkia::JsiSkPath> {
+  static const SkPath &unwrap(Holder &holder) {
+    return *holder.object->getObject();
+  }
+};
+
+} // namespace RNJsi
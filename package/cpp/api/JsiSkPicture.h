@@ -49,21 +49,7 @@ public:
 
   JSI_HOST_FUNCTION(serialize) {
     auto data = getObject()->serialize();
-    auto arrayCtor =
-        runtime.global().getPropertyAsFunction(runtime, "Uint8Array");
-    size_t size = data->size();
-
-    jsi::Object array =
-        arrayCtor.callAsConstructor(runtime, static_cast<double>(size))
-            .getObject(runtime);
-    jsi::ArrayBuffer buffer =
-        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
-            .asObject(runtime)
-            .getArrayBuffer(runtime);
-
-    auto bfrPtr = reinterpret_cast<uint8_t *>(buffer.data(runtime));
-    memcpy(bfrPtr, data->bytes(), size);
-    return array;
+    return JsiSkData::toUint8Array(runtime, std::move(data));
   }
 
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkPicture, makeShader),
@@ -81,3 +67,18 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Picture parameter of a bound method
+ */
+template <>
+struct JsiArgument<const SkPicture *>
+    : JsiHostObjectArgument<RNSkia::JsiSkPicture> {
+  static const SkPicture *unwrap(Holder &holder) {
+    return holder.object->getObject().get();
+  }
+};
+
+} // namespace RNJsi
@@ -77,3 +77,23 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Point parameter of a bound method, either a Point host object or a plain
+ object with x and y.
+ */
+template <> struct JsiArgument<SkPoint> {
+  using Holder = SkPoint;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "object", index);
+    }
+    return *RNSkia::JsiSkPoint::fromValue(runtime, value);
+  }
+  static SkPoint unwrap(Holder &holder) { return holder; }
+};
+
+} // namespace RNJsi
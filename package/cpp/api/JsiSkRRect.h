@@ -95,3 +95,23 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ RRect parameter of a bound method, either a RRect host object or a plain
+ object with rect, rx and ry.
+ */
+template <> struct JsiArgument<const SkRRect &> {
+  using Holder = std::shared_ptr<SkRRect>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "object", index);
+    }
+    return RNSkia::JsiSkRRect::fromValue(runtime, value);
+  }
+  static const SkRRect &unwrap(Holder &holder) { return *holder; }
+};
+
+} // namespace RNJsi
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include <jsi/jsi.h>
@@ -18,7 +19,8 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
-class JsiSkRect : public JsiSkWrappingSharedPtrHostObject<SkRect> {
+class JsiSkRect : public JsiSkWrappingSharedPtrHostObject<SkRect>,
+                  public JsiSkMutableHostObject {
 public:
   JSI_PROPERTY_GET(x) { return static_cast<double>(getObject()->x()); }
   JSI_PROPERTY_GET(y) { return static_cast<double>(getObject()->y()); }
@@ -41,12 +43,14 @@ public:
   JSI_HOST_FUNCTION(setXYWH) {
     getObject()->setXYWH(arguments[0].asNumber(), arguments[1].asNumber(),
                          arguments[2].asNumber(), arguments[3].asNumber());
+    markChanged();
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(setLTRB) {
     getObject()->setLTRB(arguments[0].asNumber(), arguments[1].asNumber(),
                          arguments[2].asNumber(), arguments[3].asNumber());
+    markChanged();
     return jsi::Value::undefined();
   }
 
@@ -117,3 +121,53 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Rect parameter of a bound method, either a Rect host object or a plain
+ object with x, y, width and height.
+ */
+template <> struct JsiArgument<const SkRect &> {
+  using Holder = SkRect;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "object", index);
+    }
+    auto object = value.getObject(runtime);
+    if (object.isHostObject(runtime)) {
+      auto hostObject = object.getHostObject(runtime);
+      auto rect = dynamic_cast<RNSkia::JsiSkRect *>(hostObject.get());
+      if (rect == nullptr) {
+        throwArgumentTypeError(runtime, "Rect", index);
+      }
+      return *rect->getObject();
+    }
+    auto x = object.getProperty(runtime, "x").asNumber();
+    auto y = object.getProperty(runtime, "y").asNumber();
+    auto width = object.getProperty(runtime, "width").asNumber();
+    auto height = object.getProperty(runtime, "height").asNumber();
+    return SkRect::MakeXYWH(x, y, width, height);
+  }
+  static const SkRect &unwrap(Holder &holder) { return holder; }
+};
+
+/**
+ Optional rect parameter of a bound method, null when not provided
+ */
+template <> struct JsiArgument<const SkRect *> {
+  using Holder = std::optional<SkRect>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (value.isUndefined() || value.isNull()) {
+      return std::nullopt;
+    }
+    return JsiArgument<const SkRect &>::convert(runtime, value, index);
+  }
+  static const SkRect *unwrap(Holder &holder) {
+    return holder.has_value() ? &*holder : nullptr;
+  }
+};
+
+} // namespace RNJsi
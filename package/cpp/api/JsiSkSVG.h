@@ -57,3 +57,18 @@ public:
 };
 
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ SVG parameter of a bound method. Rendering sets the container size, so
+ the document is passed as mutable.
+ */
+template <>
+struct JsiArgument<SkSVGDOM *> : JsiHostObjectArgument<RNSkia::JsiSkSVG> {
+  static SkSVGDOM *unwrap(Holder &holder) {
+    return holder.object->getObject().get();
+  }
+};
+
+} // namespace RNJsi
@@ -45,3 +45,18 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Text blob parameter of a bound method
+ */
+template <>
+struct JsiArgument<const SkTextBlob *>
+    : JsiHostObjectArgument<RNSkia::JsiSkTextBlob> {
+  static const SkTextBlob *unwrap(Holder &holder) {
+    return holder.object->getObject().get();
+  }
+};
+
+} // namespace RNJsi
@@ -156,3 +156,18 @@ public:
   }
 };
 } // namespace RNSkia
+
+namespace RNJsi {
+
+/**
+ Vertices parameter of a bound method
+ */
+template <>
+struct JsiArgument<const SkVertices *>
+    : JsiHostObjectArgument<RNSkia::JsiSkVertices> {
+  static const SkVertices *unwrap(Holder &holder) {
+    return holder.object->getObject().get();
+  }
+};
+
+} // namespace RNJsi
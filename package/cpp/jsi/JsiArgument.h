@@ -0,0 +1,249 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RNJsi {
+
+namespace jsi = facebook::jsi;
+
+/**
+ Converts a JS argument to a parameter of a native method bound with
+ JSI_EXPORT_BOUND_FUNC. Specializations provide:
+
+ - `Holder`: the value produced by `convert`, kept alive for the whole call.
+ - `static Holder convert(runtime, value, index)`: checks the type of the
+   argument and throws a JSError naming the parameter index on mismatch.
+ - `static T unwrap(Holder &)`: returns the parameter passed to the method.
+
+ Missing arguments are passed to `convert` as undefined.
+ */
+template <typename T, typename Enable = void> struct JsiArgument;
+
+/**
+ Throws the error reported for an argument of the wrong type
+ */
+[[noreturn]] inline void throwArgumentTypeError(jsi::Runtime &runtime,
+                                                const char *expected,
+                                                size_t index) {
+  throw jsi::JSError(runtime, std::string("Expected type ") + expected +
+                                  " for parameter at index " +
+                                  std::to_string(index));
+}
+
+/**
+ Numbers, including enums which are passed from JS as their numeric value
+ */
+template <typename T>
+struct JsiArgument<
+    T, std::enable_if_t<(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) ||
+                        std::is_enum_v<T>>> {
+  using Holder = double;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isNumber()) {
+      throwArgumentTypeError(runtime, "number", index);
+    }
+    return value.getNumber();
+  }
+  static T unwrap(Holder &holder) { return static_cast<T>(holder); }
+};
+
+template <> struct JsiArgument<bool> {
+  using Holder = bool;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isBool()) {
+      throwArgumentTypeError(runtime, "boolean", index);
+    }
+    return value.getBool();
+  }
+  static bool unwrap(Holder &holder) { return holder; }
+};
+
+template <> struct JsiArgument<const std::string &> {
+  using Holder = std::string;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isString()) {
+      throwArgumentTypeError(runtime, "string", index);
+    }
+    return value.getString(runtime).utf8(runtime);
+  }
+  static const std::string &unwrap(Holder &holder) { return holder; }
+};
+
+/**
+ Optional value parameter, empty when null, undefined or not provided
+ */
+template <typename T> struct JsiArgument<std::optional<T>> {
+  using Holder = std::optional<typename JsiArgument<T>::Holder>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (value.isUndefined() || value.isNull()) {
+      return std::nullopt;
+    }
+    return JsiArgument<T>::convert(runtime, value, index);
+  }
+  static std::optional<T> unwrap(Holder &holder) {
+    if (!holder.has_value()) {
+      return std::nullopt;
+    }
+    return JsiArgument<T>::unwrap(*holder);
+  }
+};
+
+/**
+ Array parameter, converting each element as a parameter of type T
+ */
+template <typename T> struct JsiArgument<const std::vector<T> &> {
+  using Holder = std::vector<T>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "array", index);
+    }
+    auto object = value.getObject(runtime);
+    if (!object.isArray(runtime)) {
+      throwArgumentTypeError(runtime, "array", index);
+    }
+    auto array = object.getArray(runtime);
+    auto size = array.size(runtime);
+    Holder elements;
+    elements.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      auto element = JsiArgument<T>::convert(
+          runtime, array.getValueAtIndex(runtime, i), index);
+      elements.push_back(JsiArgument<T>::unwrap(element));
+    }
+    return elements;
+  }
+  static const std::vector<T> &unwrap(Holder &holder) { return holder; }
+};
+
+/**
+ Optional array parameter, null when null, undefined or not provided
+ */
+template <typename T> struct JsiArgument<const std::vector<T> *> {
+  using Holder = std::optional<std::vector<T>>;
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (value.isUndefined() || value.isNull()) {
+      return std::nullopt;
+    }
+    return JsiArgument<const std::vector<T> &>::convert(runtime, value, index);
+  }
+  static const std::vector<T> *unwrap(Holder &holder) {
+    return holder.has_value() ? &*holder : nullptr;
+  }
+};
+
+/**
+ Base for arguments unwrapped from a host object of type T. The host object
+ is fetched once from the runtime and checked with a plain dynamic_cast, so
+ the only reference count taken is the one held for the duration of the call.
+ When Optional is true null, undefined and missing arguments are accepted and
+ unwrap to a null object.
+ */
+template <typename T, bool Optional = false> struct JsiHostObjectArgument {
+  struct Holder {
+    std::shared_ptr<jsi::HostObject> hostObject;
+    T *object = nullptr;
+  };
+
+  static Holder convert(jsi::Runtime &runtime, const jsi::Value &value,
+                        size_t index) {
+    if (Optional && (value.isUndefined() || value.isNull())) {
+      return Holder();
+    }
+    if (!value.isObject()) {
+      throwArgumentTypeError(runtime, "host object", index);
+    }
+    auto object = value.getObject(runtime);
+    if (!object.isHostObject(runtime)) {
+      throwArgumentTypeError(runtime, "host object", index);
+    }
+    Holder holder;
+    holder.hostObject = object.getHostObject(runtime);
+    holder.object = dynamic_cast<T *>(holder.hostObject.get());
+    if (holder.object == nullptr) {
+      throwArgumentTypeError(runtime, "host object", index);
+    }
+    return holder;
+  }
+};
+
+/**
+ Calls a native method with the arguments of a JSI host function call. The
+ arguments are converted in order, so type errors are reported for the first
+ offending parameter.
+ */
+template <typename TClass, typename TMethod, typename TReturn,
+          typename... TArgs, size_t... Indices>
+jsi::Value invokeWithArguments(TClass *self, TMethod method,
+                               jsi::Runtime &runtime,
+                               const jsi::Value *arguments, size_t count,
+                               std::index_sequence<Indices...>) {
+  const jsi::Value undefined;
+  // Braced initialization guarantees left to right evaluation
+  std::tuple<typename JsiArgument<TArgs>::Holder...> holders{
+      JsiArgument<TArgs>::convert(
+          runtime, Indices < count ? arguments[Indices] : undefined,
+          Indices)...};
+  auto call = [&]() -> TReturn {
+    return (self->*method)(
+        JsiArgument<TArgs>::unwrap(std::get<Indices>(holders))...);
+  };
+  if constexpr (std::is_void_v<TReturn>) {
+    call();
+    return jsi::Value::undefined();
+  } else if constexpr (std::is_same_v<TReturn, bool>) {
+    return jsi::Value(call());
+  } else {
+    static_assert(std::is_arithmetic_v<TReturn>,
+                  "Bound methods must return void, bool or a number");
+    return jsi::Value(static_cast<double>(call()));
+  }
+}
+
+/**
+ Splits the signature of a bound native method into its parts
+ */
+template <typename TMethod> struct JsiMethodTraits;
+
+template <typename TClass, typename TReturn, typename... TArgs>
+struct JsiMethodTraits<TReturn (TClass::*)(TArgs...)> {
+  using Class = TClass;
+
+  static jsi::Value invoke(TClass *self, TReturn (TClass::*method)(TArgs...),
+                           jsi::Runtime &runtime, const jsi::Value *arguments,
+                           size_t count) {
+    return invokeWithArguments<TClass, decltype(method), TReturn, TArgs...>(
+        self, method, runtime, arguments, count,
+        std::index_sequence_for<TArgs...>());
+  }
+};
+
+template <typename TClass, typename TReturn, typename... TArgs>
+struct JsiMethodTraits<TReturn (TClass::*)(TArgs...) const> {
+  using Class = TClass;
+
+  static jsi::Value invoke(const TClass *self,
+                           TReturn (TClass::*method)(TArgs...) const,
+                           jsi::Runtime &runtime, const jsi::Value *arguments,
+                           size_t count) {
+    return invokeWithArguments<const TClass, decltype(method), TReturn,
+                               TArgs...>(self, method, runtime, arguments,
+                                         count,
+                                         std::index_sequence_for<TArgs...>());
+  }
+};
+
+} // namespace RNJsi
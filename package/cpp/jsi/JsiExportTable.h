@@ -0,0 +1,175 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "RuntimeAwareCache.h"
+
+namespace RNJsi {
+
+namespace jsi = facebook::jsi;
+
+/**
+ An exported name and the member it resolves to
+ */
+template <typename T> struct JsiExportEntry {
+  std::string_view name;
+  T member;
+};
+
+/**
+ Creates a table of exported members sorted by name at compile time.
+ */
+template <typename TEntry, typename... TEntries>
+constexpr std::array<TEntry, sizeof...(TEntries)>
+makeExportTable(TEntries &&...entries) {
+  std::array<TEntry, sizeof...(TEntries)> table = {
+      TEntry(std::forward<TEntries>(entries))...};
+  // Insertion sort - tables are small and this runs in the compiler.
+  for (size_t i = 1; i < table.size(); ++i) {
+    for (size_t j = i; j > 0 && table[j].name < table[j - 1].name; --j) {
+      auto tmp = table[j];
+      table[j] = table[j - 1];
+      table[j - 1] = tmp;
+    }
+  }
+  return table;
+}
+
+/**
+ Returns true if all names in a sorted table are unique
+ */
+template <typename TEntry, size_t N>
+constexpr bool hasUniqueNames(const std::array<TEntry, N> &table) {
+  for (size_t i = 1; i < N; ++i) {
+    if (table[i].name == table[i - 1].name) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ A property name resolved on a host object in a runtime, with the indexes it
+ resolved to in the function table and in the getters table given by tag
+ */
+struct JsiResolvedName {
+  jsi::PropNameID name;
+  const void *tag;
+  int func;
+  int getter;
+};
+
+/**
+ Values kept per runtime for an export table
+ */
+struct JsiExportRuntimeCache {
+  std::vector<std::optional<jsi::Function>> functions;
+  // Names resolved last, replaced in turn
+  std::vector<JsiResolvedName> names;
+  size_t nextName = 0;
+};
+
+/**
+ Read-only view of a sorted table of exported members generated by the
+ JSI_EXPORT_* macros. Lookups are binary searches that never allocate.
+ */
+template <typename T> class JsiExportTable {
+public:
+  using Entry = JsiExportEntry<T>;
+
+  JsiExportTable() : _runtimeCache(true) {}
+
+  template <size_t N>
+  explicit JsiExportTable(const std::array<Entry, N> &entries)
+      : _entries(entries.data()), _size(N), _runtimeCache(true) {}
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const Entry &operator[](size_t index) const { return _entries[index]; }
+  const Entry *begin() const { return _entries; }
+  const Entry *end() const { return _entries + _size; }
+
+  /**
+   Returns the index of the entry with the given name, or -1
+   */
+  int indexOf(std::string_view name) const {
+    size_t lo = 0;
+    size_t hi = _size;
+    while (lo < hi) {
+      auto mid = lo + (hi - lo) / 2;
+      auto cmp = _entries[mid].name.compare(name);
+      if (cmp == 0) {
+        return static_cast<int>(mid);
+      } else if (cmp < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   Returns the slot holding the jsi::Function created for the entry at the
+   given index in this runtime. The functions are shared between all host
+   objects using this table.
+   */
+  std::optional<jsi::Function> &functionAt(jsi::Runtime &runtime,
+                                           size_t index) const {
+    auto &functions = _runtimeCache.get(runtime).functions;
+    if (functions.empty()) {
+      functions.resize(_size);
+    }
+    return functions[index];
+  }
+
+  /**
+   Returns the name if it was resolved recently in this runtime together with
+   the same tag, or nullptr. Names are compared by the runtime, without
+   converting them to strings.
+   */
+  const JsiResolvedName *findResolvedName(jsi::Runtime &runtime,
+                                          const jsi::PropNameID &name,
+                                          const void *tag) const {
+    for (auto &resolved : _runtimeCache.get(runtime).names) {
+      if (resolved.tag == tag &&
+          jsi::PropNameID::compare(runtime, resolved.name, name)) {
+        return &resolved;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   Remembers what the name resolved to in this runtime, replacing the name
+   that was added first once the cache is full
+   */
+  void addResolvedName(jsi::Runtime &runtime, const jsi::PropNameID &name,
+                       const void *tag, int func, int getter) const {
+    auto &cache = _runtimeCache.get(runtime);
+    JsiResolvedName resolved{jsi::PropNameID(runtime, name), tag, func, getter};
+    if (cache.names.size() < ResolvedNameCount) {
+      cache.names.push_back(std::move(resolved));
+    } else {
+      cache.names[cache.nextName] = std::move(resolved);
+      cache.nextName = (cache.nextName + 1) % ResolvedNameCount;
+    }
+  }
+
+private:
+  // Enough for the methods called in a typical loop over an object
+  static constexpr size_t ResolvedNameCount = 8;
+
+  const Entry *_entries = nullptr;
+  size_t _size = 0;
+  mutable RuntimeAwareCache<JsiExportRuntimeCache> _runtimeCache;
+};
+
+} // namespace RNJsi
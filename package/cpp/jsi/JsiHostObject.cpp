@@ -38,11 +38,9 @@ void JsiHostObject::set(jsi::Runtime &rt, const jsi::PropNameID &name,
 
   /** Check the static setters map */
   const JsiPropertySettersMap &setters = getExportedPropertySettersMap();
-  auto setter = setters.find(nameStr);
-  if (setter != setters.end()) {
-    auto dispatcher = std::bind(setter->second, this, std::placeholders::_1,
-                                std::placeholders::_2);
-    return dispatcher(rt, value);
+  auto setter = setters.indexOf(nameStr);
+  if (setter != -1) {
+    return (this->*setters[setter].member)(rt, value);
   }
 
   if (_propMap.count(nameStr) > 0) {
@@ -53,45 +51,55 @@ void JsiHostObject::set(jsi::Runtime &rt, const jsi::PropNameID &name,
 
 jsi::Value JsiHostObject::get(jsi::Runtime &runtime,
                               const jsi::PropNameID &name) {
-  auto nameStr = name.utf8(runtime);
-
-  // Happy path - cached host functions are cheapest to look up
   const JsiFunctionMap &funcs = getExportedFunctionMap();
-  auto func = funcs.find(nameStr);
-
-  // Check function cache
-  if (func != funcs.end()) {
-    std::map<std::string, jsi::Function> &runtimeCache =
-        _hostFunctionCache.get(runtime);
-    auto cachedFunc = runtimeCache.find(nameStr);
-    if (cachedFunc != runtimeCache.end()) {
-      return cachedFunc->second.asFunction(runtime);
+  const JsiPropertyGettersMap &getters = getExportedPropertyGettersMap();
+
+  // Names read repeatedly, as in loops, are found without converting them to
+  // strings. Only names of the static tables are remembered, the dynamic maps
+  // differ between instances.
+  int func = -1;
+  int getter = -1;
+  std::string nameStr;
+  auto resolved = funcs.findResolvedName(runtime, name, &getters);
+  if (resolved != nullptr) {
+    func = resolved->func;
+    getter = resolved->getter;
+  } else {
+    nameStr = name.utf8(runtime);
+    func = funcs.indexOf(nameStr);
+    getter = func == -1 ? getters.indexOf(nameStr) : -1;
+    if (func != -1 || getter != -1) {
+      funcs.addResolvedName(runtime, name, &getters, func, getter);
     }
   }
 
   // Check the static getters map
-  const JsiPropertyGettersMap &getters = getExportedPropertyGettersMap();
-  auto getter = getters.find(nameStr);
-  if (getter != getters.end()) {
-    auto dispatcher = std::bind(getter->second, this, std::placeholders::_1);
-    return dispatcher(runtime);
+  if (getter != -1) {
+    return (this->*getters[getter].member)(runtime);
   }
 
   // Check the static function map
-  if (func != funcs.end()) {
-
-    // Create dispatcher
-    auto dispatcher =
-        std::bind(func->second, reinterpret_cast<JsiHostObject *>(this),
-                  std::placeholders::_1, std::placeholders::_2,
-                  std::placeholders::_3, std::placeholders::_4);
-
-    // Add to cache - it is important to cache the results from the
-    // createFromHostFunction function which takes some time.
-    return _hostFunctionCache.get(runtime)
-        .emplace(nameStr, jsi::Function::createFromHostFunction(runtime, name,
-                                                                0, dispatcher))
-        .first->second.asFunction(runtime);
+  if (func != -1) {
+    // Check function cache - functions are shared by all instances of the
+    // class in a runtime and dispatch on the this value.
+    auto &cachedFunc = funcs.functionAt(runtime, func);
+    if (!cachedFunc.has_value()) {
+      // Create dispatcher
+      auto member = funcs[func].member;
+      auto dispatcher = [&funcs, member](jsi::Runtime &runtime,
+                                         const jsi::Value &thisValue,
+                                         const jsi::Value *arguments,
+                                         size_t count) -> jsi::Value {
+        auto self = getThis(runtime, thisValue, funcs);
+        return (self.get()->*member)(runtime, thisValue, arguments, count);
+      };
+
+      // Add to cache - it is important to cache the results from the
+      // createFromHostFunction function which takes some time.
+      cachedFunc = jsi::Function::createFromHostFunction(runtime, name, 0,
+                                                         dispatcher);
+    }
+    return cachedFunc->asFunction(runtime);
   }
 
   if (_funcMap.count(nameStr) > 0) {
@@ -107,6 +115,26 @@ jsi::Value JsiHostObject::get(jsi::Runtime &runtime,
   return jsi::Value::undefined();
 }
 
+std::shared_ptr<JsiHostObject>
+JsiHostObject::getThis(jsi::Runtime &runtime, const jsi::Value &thisValue,
+                       const JsiFunctionMap &funcs) {
+  if (thisValue.isObject()) {
+    auto obj = thisValue.getObject(runtime);
+    if (obj.isHostObject(runtime)) {
+      auto self =
+          std::dynamic_pointer_cast<JsiHostObject>(obj.getHostObject(runtime));
+      // Only objects exporting the same function table can be called with
+      // functions from it.
+      if (self != nullptr && &self->getExportedFunctionMap() == &funcs) {
+        return self;
+      }
+    }
+  }
+  throw jsi::JSError(runtime, "Function called with an invalid this value. "
+                              "Make sure to call it on the object it was "
+                              "read from.");
+}
+
 std::vector<jsi::PropNameID>
 JsiHostObject::getPropertyNames(jsi::Runtime &runtime) {
   // statically exported functions
@@ -122,17 +150,20 @@ JsiHostObject::getPropertyNames(jsi::Runtime &runtime) {
   propNames.reserve(funcs.size() + getters.size() + setters.size() +
                     _funcMap.size() + _propMap.size());
 
-  for (auto it = funcs.cbegin(); it != funcs.cend(); ++it) {
-    propNames.push_back(jsi::PropNameID::forAscii(runtime, it->first));
+  for (auto &func : funcs) {
+    propNames.push_back(jsi::PropNameID::forAscii(
+        runtime, func.name.data(), func.name.size()));
   }
 
-  for (auto it = getters.cbegin(); it != getters.cend(); ++it) {
-    propNames.push_back(jsi::PropNameID::forUtf8(runtime, it->first));
+  for (auto &getter : getters) {
+    propNames.push_back(jsi::PropNameID::forUtf8(
+        runtime, std::string(getter.name.data(), getter.name.size())));
   }
 
-  for (auto it = getters.cbegin(); it != getters.cend(); ++it) {
-    if (getters.count(it->first) == 0) {
-      propNames.push_back(jsi::PropNameID::forUtf8(runtime, it->first));
+  for (auto &setter : setters) {
+    if (getters.indexOf(setter.name) == -1) {
+      propNames.push_back(jsi::PropNameID::forUtf8(
+          runtime, std::string(setter.name.data(), setter.name.size())));
     }
   }
 
@@ -3,12 +3,13 @@
 #include <jsi/jsi.h>
 
 #include <functional>
-#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "JsiArgument.h"
+#include "JsiExportTable.h"
 #include "RuntimeAwareCache.h"
 
 #define STR_CAT_NX(A, B) A##B
@@ -47,7 +48,7 @@
  * Creates a JSI export function declaration
  */
 #define JSI_EXPORT_FUNC(CLASS, FUNCTION)                                       \
-  {                                                                            \
+  RNJsi::JsiFunctionMap::Entry {                                               \
 #FUNCTION, (jsi::Value(JsiHostObject::*)(                                  \
                    jsi::Runtime & runtime, const jsi::Value &thisValue,        \
                    const jsi::Value *arguments, size_t)) &                     \
@@ -55,19 +56,35 @@
   }
 
 /**
- * Creates a JSI export functions statement
+ * Creates a JSI export function declaration for a native method. The
+ * argument unpacking is generated from the signature of the method, see
+ * JsiArgument for the supported parameter types.
+ */
+#define JSI_EXPORT_BOUND_FUNC(CLASS, FUNCTION)                                 \
+  RNJsi::JsiFunctionMap::Entry {                                               \
+#FUNCTION, &JsiHostObject::invokeBound<&CLASS::FUNCTION>                   \
+  }
+
+/**
+ * Creates a JSI export functions statement. The table is sorted at compile
+ * time and allocated once, it is never freed since it might hold values
+ * belonging to runtimes that outlive the static destructors.
  */
 #define JSI_EXPORT_FUNCTIONS(...)                                              \
   const RNJsi::JsiFunctionMap &getExportedFunctionMap() override {             \
-    static RNJsi::JsiFunctionMap map = {__VA_ARGS__};                          \
-    return map;                                                                \
+    static constexpr auto entries =                                            \
+        RNJsi::makeExportTable<RNJsi::JsiFunctionMap::Entry>(__VA_ARGS__);     \
+    static_assert(RNJsi::hasUniqueNames(entries),                              \
+                  "Duplicate names in JSI_EXPORT_FUNCTIONS");                  \
+    static const auto *map = new RNJsi::JsiFunctionMap(entries);               \
+    return *map;                                                               \
   }
 
 /**
  * Creates a JSI export getter declaration
  */
 #define JSI_EXPORT_PROP_GET(CLASS, FUNCTION)                                   \
-  {                                                                            \
+  RNJsi::JsiPropertyGettersMap::Entry {                                        \
 #FUNCTION, (jsi::Value(JsiHostObject::*)(jsi::Runtime & runtime)) &        \
                    CLASS::STR_CAT(STR_GET, FUNCTION)                           \
   }
@@ -78,15 +95,20 @@
 #define JSI_EXPORT_PROPERTY_GETTERS(...)                                       \
   const RNJsi::JsiPropertyGettersMap &getExportedPropertyGettersMap()          \
       override {                                                               \
-    static RNJsi::JsiPropertyGettersMap map = {__VA_ARGS__};                   \
-    return map;                                                                \
+    static constexpr auto entries =                                            \
+        RNJsi::makeExportTable<RNJsi::JsiPropertyGettersMap::Entry>(           \
+            __VA_ARGS__);                                                      \
+    static_assert(RNJsi::hasUniqueNames(entries),                              \
+                  "Duplicate names in JSI_EXPORT_PROPERTY_GETTERS");           \
+    static const auto *map = new RNJsi::JsiPropertyGettersMap(entries);        \
+    return *map;                                                               \
   }
 
 /**
  * Creates a JSI export setter declaration
  */
 #define JSI_EXPORT_PROP_SET(CLASS, FUNCTION)                                   \
-  {                                                                            \
+  RNJsi::JsiPropertySettersMap::Entry {                                        \
 #FUNCTION,                                                                 \
         (void(JsiHostObject::*)(jsi::Runtime & runtime, const jsi::Value &)) & \
             CLASS::STR_CAT(STR_SET, FUNCTION)                                  \
@@ -98,8 +120,13 @@
 #define JSI_EXPORT_PROPERTY_SETTERS(...)                                       \
   const RNJsi::JsiPropertySettersMap &getExportedPropertySettersMap()          \
       override {                                                               \
-    static RNJsi::JsiPropertySettersMap map = {__VA_ARGS__};                   \
-    return map;                                                                \
+    static constexpr auto entries =                                            \
+        RNJsi::makeExportTable<RNJsi::JsiPropertySettersMap::Entry>(           \
+            __VA_ARGS__);                                                      \
+    static_assert(RNJsi::hasUniqueNames(entries),                              \
+                  "Duplicate names in JSI_EXPORT_PROPERTY_SETTERS");           \
+    static const auto *map = new RNJsi::JsiPropertySettersMap(entries);        \
+    return *map;                                                               \
   }
 
 namespace RNJsi {
@@ -114,17 +141,16 @@ using JsPropertyType = struct {
 class JsiHostObject;
 
 using JsiFunctionMap =
-    std::unordered_map<std::string, jsi::Value (JsiHostObject::*)(
-                                        jsi::Runtime &, const jsi::Value &,
-                                        const jsi::Value *, size_t)>;
+    JsiExportTable<jsi::Value (JsiHostObject::*)(jsi::Runtime &,
+                                                 const jsi::Value &,
+                                                 const jsi::Value *, size_t)>;
 
 using JsiPropertyGettersMap =
-    std::unordered_map<std::string,
-                       jsi::Value (JsiHostObject::*)(jsi::Runtime &)>;
+    JsiExportTable<jsi::Value (JsiHostObject::*)(jsi::Runtime &)>;
 
 using JsiPropertySettersMap =
-    std::unordered_map<std::string, void (JsiHostObject::*)(
-                                        jsi::Runtime &, const jsi::Value &)>;
+    JsiExportTable<void (JsiHostObject::*)(jsi::Runtime &,
+                                           const jsi::Value &)>;
 
 /**
  * Base class for jsi host objects
@@ -160,6 +186,18 @@ public:
    */
   std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &runtime) override;
 
+  /**
+   * Host function calling a native method of a subclass with arguments
+   * converted from the call. Exported with JSI_EXPORT_BOUND_FUNC.
+   */
+  template <auto Method>
+  jsi::Value invokeBound(jsi::Runtime &runtime, const jsi::Value &thisValue,
+                         const jsi::Value *arguments, size_t count) {
+    using Traits = JsiMethodTraits<decltype(Method)>;
+    return Traits::invoke(static_cast<typename Traits::Class *>(this), Method,
+                          runtime, arguments, count);
+  }
+
 protected:
   /**
    Override to return map of name/functions
@@ -362,9 +400,16 @@ protected:
   }
 
 private:
+  /**
+   Returns the host object a function from the given table was called on.
+   Functions are shared between all instances of a class, so the host object
+   is resolved from the this value of the call.
+   */
+  static std::shared_ptr<JsiHostObject> getThis(jsi::Runtime &runtime,
+                                                const jsi::Value &thisValue,
+                                                const JsiFunctionMap &funcs);
+
   std::unordered_map<std::string, jsi::HostFunctionType> _funcMap;
   std::unordered_map<std::string, JsPropertyType> _propMap;
-
-  RuntimeAwareCache<std::map<std::string, jsi::Function>> _hostFunctionCache;
 };
 } // namespace RNJsi
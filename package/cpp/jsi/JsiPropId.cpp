@@ -0,0 +1,100 @@
+#include "JsiPropId.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+namespace RNJsi {
+
+namespace {
+
+/**
+ Insert-only hash table of interned names. Each bucket is a singly linked list
+ whose head is swapped in with a compare-and-swap, so lookups never take a lock
+ and entries are never moved or freed once published.
+ */
+class AtomTable {
+public:
+  AtomTable() {
+    // Seed the table with the well-known names so that they get the ids
+    // declared in WellKnownPropId. No other thread can see the table yet.
+#define RNJSI_SEED_PROP_NAME(IDENT, NAME) seed(PropName##IDENT);
+    RNJSI_WELL_KNOWN_PROP_NAMES(RNJSI_SEED_PROP_NAME)
+#undef RNJSI_SEED_PROP_NAME
+    _nextId.store(static_cast<uint32_t>(WellKnownPropCount),
+                  std::memory_order_relaxed);
+  }
+
+  PropId get(std::string_view name) {
+    auto hash = std::hash<std::string_view>()(name);
+    auto &bucket = _buckets[hash & (BucketCount - 1)];
+    auto head = bucket.load(std::memory_order_acquire);
+    std::unique_ptr<Atom> created;
+    while (true) {
+      for (auto atom = head; atom != nullptr; atom = atom->next) {
+        if (atom->hash == hash && atom->name == name) {
+          // If we lost a race the id we took for our own atom is left unused.
+          return PropId(atom->id, atom->name.data());
+        }
+      }
+      if (created == nullptr) {
+        created = makeAtom(name, hash);
+      }
+      created->next = head;
+      if (bucket.compare_exchange_weak(head, created.get(),
+                                       std::memory_order_release,
+                                       std::memory_order_acquire)) {
+        auto atom = created.release();
+        return PropId(atom->id, atom->name.data());
+      }
+    }
+  }
+
+private:
+  static constexpr size_t BucketCount = 1024;
+
+  struct Atom {
+    std::string_view name;
+    size_t hash;
+    uint32_t id;
+    Atom *next = nullptr;
+    std::unique_ptr<char[]> storage;
+  };
+
+  std::unique_ptr<Atom> makeAtom(std::string_view name, size_t hash) {
+    auto atom = std::make_unique<Atom>();
+    atom->storage = std::make_unique<char[]>(name.size() + 1);
+    std::memcpy(atom->storage.get(), name.data(), name.size());
+    atom->storage[name.size()] = '\0';
+    atom->name = std::string_view(atom->storage.get(), name.size());
+    atom->hash = hash;
+    atom->id = _nextId.fetch_add(1, std::memory_order_relaxed);
+    return atom;
+  }
+
+  void seed(PropId propId) {
+    // Well-known names point to string literals, no need to copy them
+    auto atom = new Atom();
+    atom->name = propId.c_str();
+    atom->hash = std::hash<std::string_view>()(atom->name);
+    atom->id = propId.id();
+    auto &bucket = _buckets[atom->hash & (BucketCount - 1)];
+    atom->next = bucket.load(std::memory_order_relaxed);
+    bucket.store(atom, std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<Atom *>, BucketCount> _buckets = {};
+  std::atomic<uint32_t> _nextId = {0};
+};
+
+} // namespace
+
+PropId JsiPropId::get(std::string_view name) {
+  // The table is never destroyed so that PropIds stay valid during static
+  // destruction.
+  static auto table = new AtomTable();
+  return table->get(name);
+}
+
+} // namespace RNJsi
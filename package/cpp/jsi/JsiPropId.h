@@ -0,0 +1,240 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <string_view>
+
+namespace RNJsi {
+
+/**
+ Property names known at compile time. Each name gets a fixed id in the order
+ listed here, and a constant named PropName<Name>.
+ */
+#define RNJSI_WELL_KNOWN_PROP_NAMES(PROP)                                      \
+  PROP(0, "0")                                                                 \
+  PROP(1, "1")                                                                 \
+  PROP(2, "2")                                                                 \
+  PROP(3, "3")                                                                 \
+  PROP(Advance, "advance")                                                     \
+  PROP(AntiAlias, "antiAlias")                                                 \
+  PROP(Binding, "binding")                                                     \
+  PROP(BlendMode, "blendMode")                                                 \
+  PROP(Blob, "blob")                                                           \
+  PROP(Blur, "blur")                                                           \
+  PROP(Box, "box")                                                             \
+  PROP(C, "c")                                                                 \
+  PROP(C1, "c1")                                                               \
+  PROP(C2, "c2")                                                               \
+  PROP(ChannelX, "channelX")                                                   \
+  PROP(ChannelY, "channelY")                                                   \
+  PROP(Clamp, "clamp")                                                         \
+  PROP(Clip, "clip")                                                           \
+  PROP(Color, "color")                                                         \
+  PROP(Colors, "colors")                                                       \
+  PROP(Cx, "cx")                                                               \
+  PROP(Cy, "cy")                                                               \
+  PROP(Deviation, "deviation")                                                 \
+  PROP(Drawing, "drawing")                                                     \
+  PROP(Dx, "dx")                                                               \
+  PROP(Dy, "dy")                                                               \
+  PROP(End, "end")                                                             \
+  PROP(EndR, "endR")                                                           \
+  PROP(ExtrapolateLeft, "extrapolateLeft")                                     \
+  PROP(ExtrapolateRight, "extrapolateRight")                                   \
+  PROP(FillType, "fillType")                                                   \
+  PROP(Fit, "fit")                                                             \
+  PROP(Flags, "flags")                                                         \
+  PROP(Fm, "fm")                                                               \
+  PROP(Font, "font")                                                           \
+  PROP(FreqX, "freqX")                                                         \
+  PROP(FreqY, "freqY")                                                         \
+  PROP(Glyphs, "glyphs")                                                       \
+  PROP(Height, "height")                                                       \
+  PROP(Id, "id")                                                               \
+  PROP(Image, "image")                                                         \
+  PROP(Index, "index")                                                         \
+  PROP(Indices, "indices")                                                     \
+  PROP(InitialOffset, "initialOffset")                                         \
+  PROP(Inner, "inner")                                                         \
+  PROP(InputRange, "inputRange")                                               \
+  PROP(Interpolation, "interpolation")                                         \
+  PROP(Intervals, "intervals")                                                 \
+  PROP(InvertClip, "invertClip")                                               \
+  PROP(Layer, "layer")                                                         \
+  PROP(Length, "length")                                                       \
+  PROP(Matrix, "matrix")                                                       \
+  PROP(MiterLimit, "miter_limit")                                              \
+  PROP(Mm, "mm")                                                               \
+  PROP(Mode, "mode")                                                           \
+  PROP(Octaves, "octaves")                                                     \
+  PROP(Offset, "offset")                                                       \
+  PROP(Opacity, "opacity")                                                     \
+  PROP(Operator, "operator")                                                   \
+  PROP(Origin, "origin")                                                       \
+  PROP(Outer, "outer")                                                         \
+  PROP(OutputRange, "outputRange")                                             \
+  PROP(P1, "p1")                                                               \
+  PROP(P2, "p2")                                                               \
+  PROP(Paint, "paint")                                                         \
+  PROP(Patch, "patch")                                                         \
+  PROP(Path, "path")                                                           \
+  PROP(Phase, "phase")                                                         \
+  PROP(Picture, "picture")                                                     \
+  PROP(Points, "points")                                                       \
+  PROP(Pos, "pos")                                                             \
+  PROP(Positions, "positions")                                                 \
+  PROP(Precision, "precision")                                                 \
+  PROP(R, "r")                                                                 \
+  PROP(Radius, "radius")                                                       \
+  PROP(Rasterize, "rasterize")                                                 \
+  PROP(Rect, "rect")                                                           \
+  PROP(RespectCTM, "respectCTM")                                               \
+  PROP(Rotate, "rotate")                                                       \
+  PROP(RotateZ, "rotateZ")                                                     \
+  PROP(Rx, "rx")                                                               \
+  PROP(Ry, "ry")                                                               \
+  PROP(Scale, "scale")                                                         \
+  PROP(ScaleX, "scaleX")                                                       \
+  PROP(ScaleY, "scaleY")                                                       \
+  PROP(Seed, "seed")                                                           \
+  PROP(Selector, "selector")                                                   \
+  PROP(ShadowOnly, "shadowOnly")                                               \
+  PROP(SkewX, "skewX")                                                         \
+  PROP(SkewY, "skewY")                                                         \
+  PROP(Source, "source")                                                       \
+  PROP(Spread, "spread")                                                       \
+  PROP(Start, "start")                                                         \
+  PROP(StartR, "startR")                                                       \
+  PROP(Stroke, "stroke")                                                       \
+  PROP(StrokeCap, "strokeCap")                                                 \
+  PROP(StrokeJoin, "strokeJoin")                                               \
+  PROP(StrokeMiter, "strokeMiter")                                             \
+  PROP(StrokeWidth, "strokeWidth")                                             \
+  PROP(Style, "style")                                                         \
+  PROP(Svg, "svg")                                                             \
+  PROP(T, "t")                                                                 \
+  PROP(Text, "text")                                                           \
+  PROP(Texture, "texture")                                                     \
+  PROP(Textures, "textures")                                                   \
+  PROP(TileHeight, "tileHeight")                                               \
+  PROP(TileWidth, "tileWidth")                                                 \
+  PROP(Transform, "transform")                                                 \
+  PROP(TranslateX, "translateX")                                               \
+  PROP(TranslateY, "translateY")                                               \
+  PROP(Tx, "tx")                                                               \
+  PROP(Ty, "ty")                                                               \
+  PROP(Uniforms, "uniforms")                                                   \
+  PROP(Value, "value")                                                         \
+  PROP(Vertices, "vertices")                                                   \
+  PROP(Width, "width")                                                         \
+  PROP(X, "x")                                                                 \
+  PROP(Y, "y")
+
+/**
+ An interned property name. All PropIds with the same name share the same id,
+ so they are compared and hashed by their integer id. The name is never freed.
+ */
+class PropId {
+public:
+  static constexpr uint32_t InvalidId = std::numeric_limits<uint32_t>::max();
+
+  constexpr PropId() : _id(InvalidId), _name("") {}
+
+  /**
+   Used by the atom table and the well-known names. Use JsiPropId::get to look
+   up a name.
+   */
+  constexpr PropId(uint32_t id, const char *name) : _id(id), _name(name) {}
+
+  /**
+   Returns the id of the name. Ids are small and dense, and well-known names
+   have ids below WellKnownPropCount.
+   */
+  constexpr uint32_t id() const { return _id; }
+
+  /**
+   Returns the name as a null terminated string
+   */
+  constexpr const char *c_str() const { return _name; }
+
+  constexpr operator const char *() const { return _name; } // NOLINT
+
+  constexpr bool operator==(const PropId &other) const {
+    return _id == other._id;
+  }
+  constexpr bool operator!=(const PropId &other) const {
+    return _id != other._id;
+  }
+  constexpr bool operator<(const PropId &other) const {
+    return _id < other._id;
+  }
+
+private:
+  uint32_t _id;
+  const char *_name;
+};
+
+enum class WellKnownPropId : uint32_t {
+#define RNJSI_PROP_ID(IDENT, NAME) Id##IDENT,
+  RNJSI_WELL_KNOWN_PROP_NAMES(RNJSI_PROP_ID)
+#undef RNJSI_PROP_ID
+      Count
+};
+
+constexpr size_t WellKnownPropCount =
+    static_cast<size_t>(WellKnownPropId::Count);
+
+#define RNJSI_PROP_NAME(IDENT, NAME)                                           \
+  constexpr PropId PropName##IDENT{                                            \
+      static_cast<uint32_t>(WellKnownPropId::Id##IDENT), NAME};
+RNJSI_WELL_KNOWN_PROP_NAMES(RNJSI_PROP_NAME)
+#undef RNJSI_PROP_NAME
+
+/**
+ Set of well-known property names backed by a bitset
+ */
+class PropIdSet {
+public:
+  PropIdSet(std::initializer_list<PropId> ids) {
+    for (auto &id : ids) {
+      _bits.set(id.id());
+    }
+  }
+
+  /**
+   Returns true if the name is in the set
+   */
+  bool contains(PropId id) const {
+    return id.id() < WellKnownPropCount && _bits.test(id.id());
+  }
+
+private:
+  std::bitset<WellKnownPropCount> _bits;
+};
+
+/**
+ Interns property names into a lock-free atom table that hands out dense
+ integer ids.
+ */
+class JsiPropId {
+public:
+  /**
+   Returns the PropId for the given name, adding it to the table the first
+   time it is seen. Safe to call from any thread.
+   */
+  static PropId get(std::string_view name);
+};
+
+} // namespace RNJsi
+
+namespace std {
+template <> struct hash<RNJsi::PropId> {
+  size_t operator()(const RNJsi::PropId &propId) const noexcept {
+    return propId.id();
+  }
+};
+} // namespace std
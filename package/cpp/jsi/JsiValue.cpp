@@ -1,8 +1,85 @@
 #include "JsiValue.h"
 
+#include <cstring>
+#include <variant>
+
 namespace RNJsi {
 
-JsiValue::JsiValue() : _type(PropType::Undefined) {}
+using JsiValueEntries = std::vector<std::pair<PropId, JsiValue>>;
+
+/**
+ Storage for values that does not fit inline in a JsiValue. Objects are kept as
+ a flat list of key / value pairs in enumeration order.
+ */
+struct JsiValue::Payload {
+  std::variant<std::string, std::shared_ptr<jsi::HostObject>,
+               jsi::HostFunctionType, std::vector<JsiValue>, JsiValueEntries,
+               JsiTypedArray>
+      value;
+};
+
+template <typename T> T &JsiValue::preparePayload() {
+  // Reuse the previous payload and whatever it has allocated if no other copy
+  // of this value is sharing it.
+  if (_payload != nullptr && _payload.use_count() == 1) {
+    if (auto existing = std::get_if<T>(&_payload->value)) {
+      return *existing;
+    }
+  } else {
+    _payload = std::make_shared<Payload>();
+  }
+  return _payload->value.template emplace<T>();
+}
+
+template <typename T> const T &JsiValue::payload() const {
+  return std::get<T>(_payload->value);
+}
+
+namespace {
+
+uint64_t mixHash(uint64_t value) {
+  // splitmix64 finalizer
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+uint64_t combineHash(uint64_t seed, uint64_t value) {
+  return mixHash(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) +
+                         (seed >> 2)));
+}
+
+uint64_t hashBytes(const void *data, size_t size) {
+  // FNV-1a
+  auto bytes = static_cast<const uint8_t *>(data);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+uint64_t hashOf(PropType type, uint64_t value) {
+  return combineHash(static_cast<uint64_t>(type), value);
+}
+
+uint64_t hashOfNumber(double value) {
+  // 0 and -0 are equal and must have the same hash
+  if (value == 0) {
+    value = 0;
+  }
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return hashOf(PropType::Number, bits);
+}
+
+} // namespace
+
+JsiValue::JsiValue()
+    : _type(PropType::Undefined), _hash(hashOf(PropType::Undefined, 0)) {}
 
 JsiValue::JsiValue(jsi::Runtime &runtime, const jsi::Value &value)
     : JsiValue() {
@@ -10,26 +87,29 @@ JsiValue::JsiValue(jsi::Runtime &runtime, const jsi::Value &value)
 }
 
 void JsiValue::setCurrent(jsi::Runtime &runtime, const jsi::Value &value) {
-  _stringValue = "";
-  _hostObject = nullptr;
-  _hostFunction = nullptr;
-  _props.clear();
-  _array.clear();
-  _keysCache.clear();
-
   if (value.isNumber()) {
     _type = PropType::Number;
     _numberValue = value.asNumber();
+    _hash = hashOfNumber(_numberValue);
+    _payload = nullptr;
   } else if (value.isBool()) {
     _type = PropType::Bool;
     _boolValue = value.getBool();
+    _hash = hashOf(_type, _boolValue);
+    _payload = nullptr;
   } else if (value.isString()) {
+    auto &str = preparePayload<std::string>();
+    str = value.asString(runtime).utf8(runtime);
     _type = PropType::String;
-    _stringValue = value.asString(runtime).utf8(runtime);
+    _hash = hashOf(_type, hashBytes(str.data(), str.size()));
   } else if (value.isUndefined()) {
     _type = PropType::Undefined;
+    _hash = hashOf(_type, 0);
+    _payload = nullptr;
   } else if (value.isNull()) {
     _type = PropType::Null;
+    _hash = hashOf(_type, 0);
+    _payload = nullptr;
   } else if (value.isObject()) {
     setObject(runtime, value);
   } else {
@@ -62,7 +142,7 @@ const std::string &JsiValue::getAsString() const {
     throw std::runtime_error("Expected type string, got " +
                              getTypeAsString(_type));
   }
-  return _stringValue;
+  return payload<std::string>();
 }
 
 const std::vector<JsiValue> &JsiValue::getAsArray() const {
@@ -70,23 +150,42 @@ const std::vector<JsiValue> &JsiValue::getAsArray() const {
     throw std::runtime_error("Expected type array, got " +
                              getTypeAsString(_type));
   }
-  return _array;
+  return payload<std::vector<JsiValue>>();
 }
 
-const JsiValue &JsiValue::getValue(PropId name) const {
-  if (_type != PropType::Object) {
-    throw std::runtime_error("Expected type object, got " +
+const JsiTypedArray &JsiValue::getAsTypedArray() const {
+  if (_type != PropType::TypedArray) {
+    throw std::runtime_error("Expected type typed array, got " +
                              getTypeAsString(_type));
   }
-  return _props.at(name);
+  return payload<JsiTypedArray>();
 }
 
-bool JsiValue::hasValue(PropId name) const {
+const JsiValue *JsiValue::findValue(PropId name) const {
   if (_type != PropType::Object) {
     throw std::runtime_error("Expected type object, got " +
                              getTypeAsString(_type));
   }
-  return _props.count(name) > 0;
+  // Objects passed as props are small, a linear scan over the integer ids is
+  // faster than hashing.
+  for (auto &entry : payload<JsiValueEntries>()) {
+    if (entry.first == name) {
+      return &entry.second;
+    }
+  }
+  return nullptr;
+}
+
+const JsiValue &JsiValue::getValue(PropId name) const {
+  auto value = findValue(name);
+  if (value == nullptr) {
+    throw std::out_of_range("Could not find property " + std::string(name));
+  }
+  return *value;
+}
+
+bool JsiValue::hasValue(PropId name) const {
+  return findValue(name) != nullptr;
 }
 
 std::vector<PropId> JsiValue::getKeys() const {
@@ -94,15 +193,21 @@ std::vector<PropId> JsiValue::getKeys() const {
     throw std::runtime_error("Expected type object, got " +
                              getTypeAsString(_type));
   }
-  return _keysCache;
+  auto &entries = payload<JsiValueEntries>();
+  std::vector<PropId> keys;
+  keys.reserve(entries.size());
+  for (auto &entry : entries) {
+    keys.push_back(entry.first);
+  }
+  return keys;
 }
 
-std::shared_ptr<jsi::HostObject> JsiValue::getAsHostObject() const {
+const std::shared_ptr<jsi::HostObject> &JsiValue::getAsHostObject() const {
   if (_type != PropType::HostObject) {
     throw std::runtime_error("Expected type host object, got " +
                              getTypeAsString(_type));
   }
-  return _hostObject;
+  return payload<std::shared_ptr<jsi::HostObject>>();
 }
 
 jsi::HostFunctionType JsiValue::getAsHostFunction() const {
@@ -110,7 +215,7 @@ jsi::HostFunctionType JsiValue::getAsHostFunction() const {
     throw std::runtime_error("Expected type host function, got " +
                              getTypeAsString(_type));
   }
-  return _hostFunction;
+  return payload<jsi::HostFunctionType>();
 }
 
 const jsi::HostFunctionType JsiValue::getAsFunction() const {
@@ -128,11 +233,13 @@ std::string JsiValue::asString() const {
   case PropType::Bool:
     return std::to_string(_boolValue);
   case PropType::String:
-    return _stringValue;
+    return payload<std::string>();
   case PropType::Object:
     return "[Object]";
   case PropType::Array:
     return "[Array]";
+  case PropType::TypedArray:
+    return "[TypedArray]";
   case PropType::HostObject:
     return "[HostObject]";
   case PropType::HostFunction:
@@ -151,11 +258,13 @@ jsi::Value JsiValue::getAsJsiValue(jsi::Runtime &runtime) const {
   case PropType::Bool:
     return _boolValue;
   case PropType::String:
-    return jsi::String::createFromUtf8(runtime, _stringValue);
+    return jsi::String::createFromUtf8(runtime, payload<std::string>());
   case PropType::Object:
     return getObject(runtime);
   case PropType::Array:
     return getArray(runtime);
+  case PropType::TypedArray:
+    return getTypedArray(runtime);
   case PropType::HostObject:
     return getHostObject(runtime);
   case PropType::HostFunction:
@@ -179,6 +288,8 @@ std::string JsiValue::getTypeAsString(PropType type) {
     return "object";
   case PropType::Array:
     return "array";
+  case PropType::TypedArray:
+    return "typedarray";
   case PropType::HostObject:
     return "hostobject";
   case PropType::HostFunction:
@@ -194,37 +305,51 @@ void JsiValue::setObject(jsi::Runtime &runtime, const jsi::Value &value) {
     setArray(runtime, obj);
   } else if (obj.isHostObject(runtime)) {
     setHostObject(runtime, obj);
+  } else if (obj.isArrayBuffer(runtime)) {
+    setArrayBuffer(runtime, obj);
   } else {
-    _type = PropType::Object;
-    // Read object keys
     auto keys = obj.getPropertyNames(runtime);
     size_t size = keys.size(runtime);
-    _keysCache.clear();
-    _keysCache.reserve(size);
-    _props.clear();
-    _props.reserve(size);
+    // Typed arrays enumerate an index key per element, so only objects without
+    // keys or starting with the first index are probed for a backing buffer.
+    if ((size == 0 || keys.getValueAtIndex(runtime, 0)
+                              .asString(runtime)
+                              .utf8(runtime) == "0") &&
+        setTypedArray(runtime, obj)) {
+      return;
+    }
 
+    auto &entries = preparePayload<JsiValueEntries>();
+    _type = PropType::Object;
+    // Update the previous entries in place so that their storage is reused
+    entries.resize(size);
+
+    // Entries are compared without regard to their order, so their hashes
+    // are combined with an order independent sum.
+    uint64_t hash = 0;
     for (size_t i = 0; i < size; ++i) {
       auto key = JsiPropId::get(
           keys.getValueAtIndex(runtime, i).asString(runtime).utf8(runtime));
       try {
-        _props.try_emplace(key, runtime, obj.getProperty(runtime, key));
-        _keysCache.push_back(key);
+        entries[i].first = key;
+        entries[i].second.setCurrent(runtime, obj.getProperty(runtime, key));
       } catch (jsi::JSError e) {
         throw jsi::JSError(runtime,
                            "Could not set property for key " +
                                std::string(key) + ":\n" + e.getMessage(),
                            e.getStack());
       }
+      hash += combineHash(key.id(), entries[i].second._hash);
     }
+    _hash = hashOf(_type, hash);
   }
 }
 
 jsi::Object JsiValue::getObject(jsi::Runtime &runtime) const {
   assert(_type == PropType::Object);
   auto obj = jsi::Object(runtime);
-  for (auto &p : _props) {
-    obj.setProperty(runtime, p.first, p.second.getAsJsiValue(runtime));
+  for (auto &entry : payload<JsiValueEntries>()) {
+    obj.setProperty(runtime, entry.first, entry.second.getAsJsiValue(runtime));
   }
   return obj;
 }
@@ -239,6 +364,12 @@ bool JsiValue::operator==(const JsiValue &other) const {
     return false;
   }
 
+  // Values that are equal always have the same hash, so we only need to do a
+  // deep compare when the hashes are equal.
+  if (other._hash != _hash) {
+    return false;
+  }
+
   switch (_type) {
   case PropType::Null:
   case PropType::Undefined:
@@ -248,31 +379,42 @@ bool JsiValue::operator==(const JsiValue &other) const {
   case PropType::Bool:
     return _boolValue == other.getAsBool();
   case PropType::String:
-    return _stringValue == other.getAsString();
+    return payload<std::string>() == other.payload<std::string>();
   case PropType::Object: {
-    if (_props.size() != other.getProps().size()) {
+    if (_payload == other._payload) {
+      return true;
+    }
+    auto &entries = payload<JsiValueEntries>();
+    if (entries.size() != other.payload<JsiValueEntries>().size()) {
       return false;
     }
-    for (auto &p : _props) {
-      auto t = p.second.operator==(other.getValue(p.first));
-      if (!t) {
+    for (auto &entry : entries) {
+      auto otherValue = other.findValue(entry.first);
+      if (otherValue == nullptr || entry.second != *otherValue) {
         return false;
       }
     }
     return true;
   }
   case PropType::Array: {
-    auto otherArr = other.getAsArray();
-    if (_array.size() != otherArr.size()) {
+    if (_payload == other._payload) {
+      return true;
+    }
+    auto &array = payload<std::vector<JsiValue>>();
+    auto &otherArray = other.payload<std::vector<JsiValue>>();
+    if (array.size() != otherArray.size()) {
       return false;
     }
-    for (size_t i = 0; i < _array.size(); ++i) {
-      if (!_array[i].operator==(otherArr[i])) {
+    for (size_t i = 0; i < array.size(); ++i) {
+      if (array[i] != otherArray[i]) {
         return false;
       }
     }
     return true;
   }
+  case PropType::TypedArray:
+    return _payload == other._payload ||
+           payload<JsiTypedArray>() == other.payload<JsiTypedArray>();
   case PropType::HostObject:
     return getAsHostObject() == other.getAsHostObject();
   case PropType::HostFunction:
@@ -288,15 +430,17 @@ bool JsiValue::operator==(const JsiValue &other) const {
 
 void JsiValue::setFunction(jsi::Runtime &runtime, const jsi::Value &value) {
   auto func = value.asObject(runtime).asFunction(runtime);
+  auto &hostFunction = preparePayload<jsi::HostFunctionType>();
+  _type = PropType::HostFunction;
+  // Functions are never equal, so they all share the same hash
+  _hash = hashOf(_type, 0);
   if (func.isHostFunction(runtime)) {
-    _type = PropType::HostFunction;
-    _hostFunction = func.getHostFunction(runtime);
+    hostFunction = func.getHostFunction(runtime);
   } else {
-    _type = PropType::HostFunction;
     auto obj = std::make_shared<jsi::Object>(value.asObject(runtime));
-    _hostFunction = [obj](jsi::Runtime &runtime, const jsi::Value &thisValue,
-                          const jsi::Value *arguments,
-                          size_t count) -> jsi::Value {
+    hostFunction = [obj](jsi::Runtime &runtime, const jsi::Value &thisValue,
+                         const jsi::Value *arguments,
+                         size_t count) -> jsi::Value {
       auto func = obj->asFunction(runtime);
       if (thisValue.isNull() || thisValue.isUndefined()) {
         return func.call(runtime, arguments, count);
@@ -311,36 +455,173 @@ void JsiValue::setFunction(jsi::Runtime &runtime, const jsi::Value &value) {
 jsi::Object JsiValue::getHostFunction(jsi::Runtime &runtime) const {
   assert(_type == PropType::HostFunction);
   return jsi::Function::createFromHostFunction(
-      runtime, jsi::PropNameID::forUtf8(runtime, "fn"), 0, _hostFunction);
+      runtime, jsi::PropNameID::forUtf8(runtime, "fn"), 0,
+      payload<jsi::HostFunctionType>());
 }
 
 void JsiValue::setArray(jsi::Runtime &runtime, const jsi::Object &obj) {
-  _type = PropType::Array;
   auto arr = obj.asArray(runtime);
   size_t size = arr.size(runtime);
-  _array.reserve(size);
+  auto &array = preparePayload<std::vector<JsiValue>>();
+  _type = PropType::Array;
+  // Update the previous elements in place so that their storage is reused
+  array.resize(size);
+  uint64_t hash = size;
   for (size_t i = 0; i < size; ++i) {
-    _array.emplace_back(runtime, arr.getValueAtIndex(runtime, i));
+    array[i].setCurrent(runtime, arr.getValueAtIndex(runtime, i));
+    hash = combineHash(hash, array[i]._hash);
   }
+  _hash = hashOf(_type, hash);
 }
 
 jsi::Array JsiValue::getArray(jsi::Runtime &runtime) const {
   assert(_type == PropType::Array);
-  jsi::Array arr = jsi::Array(runtime, _array.size());
-  for (size_t i = 0; i < _array.size(); ++i) {
-    arr.setValueAtIndex(runtime, i, _array[i].getAsJsiValue(runtime));
+  auto &array = payload<std::vector<JsiValue>>();
+  jsi::Array arr = jsi::Array(runtime, array.size());
+  for (size_t i = 0; i < array.size(); ++i) {
+    arr.setValueAtIndex(runtime, i, array[i].getAsJsiValue(runtime));
   }
   return arr;
 }
 
 void JsiValue::setHostObject(jsi::Runtime &runtime, const jsi::Object &obj) {
+  auto &hostObject = preparePayload<std::shared_ptr<jsi::HostObject>>();
+  hostObject = obj.asHostObject(runtime);
   _type = PropType::HostObject;
-  _hostObject = obj.asHostObject(runtime);
+  _hash = hashOf(_type, reinterpret_cast<uintptr_t>(hostObject.get()));
 }
 
 jsi::Object JsiValue::getHostObject(jsi::Runtime &runtime) const {
   assert(_type == PropType::HostObject);
-  return jsi::Object::createFromHostObject(runtime, _hostObject);
+  return jsi::Object::createFromHostObject(
+      runtime, payload<std::shared_ptr<jsi::HostObject>>());
+}
+
+struct TypedArrayInfo {
+  TypedArrayKind kind;
+  const char *name;
+  size_t bytesPerElement;
+};
+
+static const TypedArrayInfo TypedArrayInfos[] = {
+    {TypedArrayKind::ArrayBuffer, "ArrayBuffer", 1},
+    {TypedArrayKind::Int8Array, "Int8Array", 1},
+    {TypedArrayKind::Uint8Array, "Uint8Array", 1},
+    {TypedArrayKind::Uint8ClampedArray, "Uint8ClampedArray", 1},
+    {TypedArrayKind::Int16Array, "Int16Array", 2},
+    {TypedArrayKind::Uint16Array, "Uint16Array", 2},
+    {TypedArrayKind::Int32Array, "Int32Array", 4},
+    {TypedArrayKind::Uint32Array, "Uint32Array", 4},
+    {TypedArrayKind::Float32Array, "Float32Array", 4},
+    {TypedArrayKind::Float64Array, "Float64Array", 8}};
+
+size_t JsiTypedArray::getBytesPerElement(TypedArrayKind kind) {
+  return TypedArrayInfos[static_cast<size_t>(kind)].bytesPerElement;
+}
+
+double JsiTypedArray::getAsNumber(size_t index) const {
+  if (index >= size()) {
+    throw std::out_of_range("Index " + std::to_string(index) +
+                            " is out of range for a typed array of size " +
+                            std::to_string(size()) + ".");
+  }
+  switch (_kind) {
+  case TypedArrayKind::Int8Array:
+    return data<int8_t>()[index];
+  case TypedArrayKind::ArrayBuffer:
+  case TypedArrayKind::Uint8Array:
+  case TypedArrayKind::Uint8ClampedArray:
+    return data<uint8_t>()[index];
+  case TypedArrayKind::Int16Array:
+    return data<int16_t>()[index];
+  case TypedArrayKind::Uint16Array:
+    return data<uint16_t>()[index];
+  case TypedArrayKind::Int32Array:
+    return data<int32_t>()[index];
+  case TypedArrayKind::Uint32Array:
+    return data<uint32_t>()[index];
+  case TypedArrayKind::Float32Array:
+    return data<float>()[index];
+  case TypedArrayKind::Float64Array:
+    return data<double>()[index];
+  }
+  return 0;
+}
+
+void JsiValue::setArrayBuffer(jsi::Runtime &runtime, const jsi::Object &obj) {
+  auto arrayBuffer = obj.getArrayBuffer(runtime);
+  auto &typedArray = preparePayload<JsiTypedArray>();
+  typedArray._kind = TypedArrayKind::ArrayBuffer;
+  auto data = arrayBuffer.data(runtime);
+  typedArray._bytes.assign(data, data + arrayBuffer.size(runtime));
+  _type = PropType::TypedArray;
+  _hash = hashOf(_type, combineHash(static_cast<uint64_t>(typedArray._kind),
+                                    hashBytes(data, typedArray.byteLength())));
+}
+
+bool JsiValue::setTypedArray(jsi::Runtime &runtime, const jsi::Object &obj) {
+  auto buffer = obj.getProperty(runtime, "buffer");
+  if (!buffer.isObject() || !buffer.getObject(runtime).isArrayBuffer(runtime)) {
+    return false;
+  }
+  // The element type is given by the constructor, subclasses and unknown
+  // kinds are read as plain objects.
+  auto constructor = obj.getProperty(runtime, "constructor");
+  if (!constructor.isObject()) {
+    return false;
+  }
+  auto name = constructor.getObject(runtime).getProperty(runtime, "name");
+  if (!name.isString()) {
+    return false;
+  }
+  auto nameStr = name.getString(runtime).utf8(runtime);
+  const TypedArrayInfo *info = nullptr;
+  for (auto &candidate : TypedArrayInfos) {
+    if (candidate.kind != TypedArrayKind::ArrayBuffer &&
+        nameStr == candidate.name) {
+      info = &candidate;
+      break;
+    }
+  }
+  if (info == nullptr) {
+    return false;
+  }
+
+  auto arrayBuffer = buffer.getObject(runtime).getArrayBuffer(runtime);
+  auto byteOffset =
+      static_cast<size_t>(obj.getProperty(runtime, "byteOffset").asNumber());
+  auto byteLength =
+      static_cast<size_t>(obj.getProperty(runtime, "byteLength").asNumber());
+  if (byteOffset + byteLength > arrayBuffer.size(runtime)) {
+    return false;
+  }
+
+  auto &typedArray = preparePayload<JsiTypedArray>();
+  typedArray._kind = info->kind;
+  auto data = arrayBuffer.data(runtime) + byteOffset;
+  typedArray._bytes.assign(data, data + byteLength);
+  _type = PropType::TypedArray;
+  _hash = hashOf(_type, combineHash(static_cast<uint64_t>(typedArray._kind),
+                                    hashBytes(data, byteLength)));
+  return true;
+}
+
+jsi::Object JsiValue::getTypedArray(jsi::Runtime &runtime) const {
+  assert(_type == PropType::TypedArray);
+  auto &typedArray = payload<JsiTypedArray>();
+  auto name = TypedArrayInfos[static_cast<size_t>(typedArray.getKind())].name;
+  auto constructor = runtime.global().getPropertyAsFunction(runtime, name);
+  auto length = static_cast<double>(typedArray.size());
+  auto result =
+      constructor.callAsConstructor(runtime, length).asObject(runtime);
+  auto arrayBuffer =
+      typedArray.getKind() == TypedArrayKind::ArrayBuffer
+          ? result.getArrayBuffer(runtime)
+          : result.getPropertyAsObject(runtime, "buffer")
+                .getArrayBuffer(runtime);
+  std::memcpy(arrayBuffer.data(runtime), typedArray._bytes.data(),
+              typedArray.byteLength());
+  return result;
 }
 
 } // namespace RNJsi
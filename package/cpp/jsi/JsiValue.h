@@ -4,10 +4,11 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "JsiPropId.h"
+
 namespace RNJsi {
 
 namespace jsi = facebook::jsi;
@@ -21,38 +22,80 @@ enum struct PropType {
   Object = 5,
   HostObject = 6,
   HostFunction = 7,
-  Array = 8
+  Array = 8,
+  TypedArray = 9
 };
 
-using PropId = const char *;
+/**
+ Element type of a typed array. Plain ArrayBuffers are read as bytes.
+ */
+enum struct TypedArrayKind {
+  ArrayBuffer = 0,
+  Int8Array = 1,
+  Uint8Array = 2,
+  Uint8ClampedArray = 3,
+  Int16Array = 4,
+  Uint16Array = 5,
+  Int32Array = 6,
+  Uint32Array = 7,
+  Float32Array = 8,
+  Float64Array = 9
+};
 
-class JsiPropId {
+/**
+ A copy of the contents of a JS typed array or ArrayBuffer
+ */
+class JsiTypedArray {
 public:
-  static const char *get(const std::string &name) { return _get(name); }
+  /**
+   Returns the element type
+   */
+  TypedArrayKind getKind() const { return _kind; }
 
-  static const char *get(const std::string &&name) {
-    return _get(std::move(name));
-  }
+  /**
+   Returns the number of elements
+   */
+  size_t size() const { return _bytes.size() / getBytesPerElement(_kind); }
 
-private:
-  static const char *_get(const std::string &name) {
-    if (_impls().count(name) == 0) {
-      // Alloc string
-      char *impl = new char[name.size() + 1];
-      strncpy(impl, name.c_str(), name.size() + 1);
-      _impls().emplace(name, impl);
-    }
-    return _impls().at(name);
+  /**
+   Returns the size of the contents in bytes
+   */
+  size_t byteLength() const { return _bytes.size(); }
+
+  /**
+   Returns a pointer to the elements. T must match the element type.
+   */
+  template <typename T> const T *data() const {
+    return reinterpret_cast<const T *>(_bytes.data());
   }
 
-  static std::unordered_map<std::string, PropId> &_impls() {
-    static std::unordered_map<std::string, PropId> impls;
-    return impls;
+  /**
+   Returns the element at the given index converted to a number
+   */
+  double getAsNumber(size_t index) const;
+
+  /**
+   Returns the size in bytes of one element of the given kind
+   */
+  static size_t getBytesPerElement(TypedArrayKind kind);
+
+  bool operator==(const JsiTypedArray &other) const {
+    return _kind == other._kind && _bytes == other._bytes;
   }
+
+private:
+  friend class JsiValue;
+
+  TypedArrayKind _kind = TypedArrayKind::ArrayBuffer;
+  std::vector<uint8_t> _bytes;
 };
 
 /**
  This is a class that deep copies values from JS to C++.
+
+ Numbers, booleans, null and undefined are stored inline. Other values live in
+ a reference counted payload that is shared when a JsiValue is copied, and
+ reused in place by setCurrent when it is not shared with any other copy.
  */
 class JsiValue {
 public:
@@ -112,6 +155,12 @@ public:
    */
   const std::vector<JsiValue> &getAsArray() const;
 
+  /**
+   Returns the typed array value. Requires that the underlying type is typed
+   array
+   */
+  const JsiTypedArray &getAsTypedArray() const;
+
   /**
    Returns an inner value by name. Requires that the underlying type is Object
    */
@@ -131,18 +180,14 @@ public:
    Returns the host object value. Requires that the underlying type is Host
    Object
    */
-  std::shared_ptr<jsi::HostObject> getAsHostObject() const;
+  const std::shared_ptr<jsi::HostObject> &getAsHostObject() const;
 
   /**
    Returns a dynamic cast of the host object value. Requires that the underlying
    type is Host Object
    */
   template <typename T> std::shared_ptr<T> getAs() const {
-    if (_type != PropType::HostObject) {
-      throw std::runtime_error("Expected type host object, got " +
-                               getTypeAsString(_type));
-    }
-    return std::dynamic_pointer_cast<T>(_hostObject);
+    return std::dynamic_pointer_cast<T>(getAsHostObject());
   }
 
   /**
@@ -171,6 +216,12 @@ public:
    */
   static std::string getTypeAsString(PropType type);
 
+  /**
+   Returns a hash of the value's contents, computed when the value was read.
+   Values that are equal have the same hash.
+   */
+  uint64_t getHash() const { return _hash; }
+
   /**
    Implements the equals operator
    */
@@ -181,20 +232,6 @@ public:
    */
   bool operator!=(const JsiValue &other) const;
 
-protected:
-  const std::unordered_map<PropId, JsiValue> &getProps() const {
-    return _props;
-  }
-
-  bool boolValue() const { return _boolValue; }
-  double numberValue() const { return _numberValue; }
-  std::string stringValue() const { return _stringValue; }
-  std::shared_ptr<jsi::HostObject> hostObject() const { return _hostObject; }
-  jsi::HostFunctionType hostFunction() const { return _hostFunction; }
-  std::vector<JsiValue> array() const { return _array; }
-  std::unordered_map<PropId, JsiValue> props() const { return _props; }
-  const std::vector<PropId> &keysCache() const { return _keysCache; }
-
 private:
   void setObject(jsi::Runtime &runtime, const jsi::Value &value);
   jsi::Object getObject(jsi::Runtime &runtime) const;
@@ -205,18 +242,27 @@ private:
   void setArray(jsi::Runtime &runtime, const jsi::Object &obj);
   jsi::Array getArray(jsi::Runtime &runtime) const;
 
+  void setArrayBuffer(jsi::Runtime &runtime, const jsi::Object &obj);
+  bool setTypedArray(jsi::Runtime &runtime, const jsi::Object &obj);
+  jsi::Object getTypedArray(jsi::Runtime &runtime) const;
+
   void setHostObject(jsi::Runtime &runtime, const jsi::Object &obj);
   jsi::Object getHostObject(jsi::Runtime &runtime) const;
 
+  struct Payload;
+
+  template <typename T> T &preparePayload();
+  template <typename T> const T &payload() const;
+
+  const JsiValue *findValue(PropId name) const;
+
   PropType _type = PropType::Undefined;
-  bool _boolValue;
-  double _numberValue;
-  std::string _stringValue = "";
-  std::shared_ptr<jsi::HostObject> _hostObject;
-  jsi::HostFunctionType _hostFunction;
-  std::vector<JsiValue> _array;
-  std::unordered_map<PropId, JsiValue> _props;
-  std::vector<PropId> _keysCache;
+  union {
+    bool _boolValue;
+    double _numberValue = 0;
+  };
+  uint64_t _hash = 0;
+  std::shared_ptr<Payload> _payload;
 };
 
 } // namespace RNJsi
@@ -2,6 +2,8 @@
 
 namespace RNJsi {
 
-jsi::Runtime *BaseRuntimeAwareCache::_mainRuntime = nullptr;
+std::atomic<jsi::Runtime *> BaseRuntimeAwareCache::_mainRuntime = {nullptr};
+// Zero is never used so that empty thread slots don't match any cache
+std::atomic<uint64_t> BaseRuntimeAwareCache::_nextCacheId = {1};
 
 } // namespace RNJsi
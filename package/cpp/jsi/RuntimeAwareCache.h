@@ -2,7 +2,10 @@
 
 #include <jsi/jsi.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 
@@ -14,19 +17,33 @@ namespace jsi = facebook::jsi;
 
 class BaseRuntimeAwareCache {
 public:
-  static void setMainJsRuntime(jsi::Runtime *rt) { _mainRuntime = rt; }
+  static void setMainJsRuntime(jsi::Runtime *rt) {
+    _mainRuntime.store(rt, std::memory_order_release);
+  }
 
 protected:
+  /**
+   Returns a process wide unique id for a cache instance. Unlike the address
+   of the cache it is never reused after the cache is destroyed.
+   */
+  static uint64_t nextCacheId() {
+    return _nextCacheId.fetch_add(1, std::memory_order_relaxed);
+  }
+
   static jsi::Runtime *getMainJsRuntime() {
-    assert(_mainRuntime != nullptr &&
+    auto mainRuntime = _mainRuntime.load(std::memory_order_acquire);
+    assert(mainRuntime != nullptr &&
            "Expected main Javascript runtime to be set in the "
            "BaseRuntimeAwareCache class.");
 
-    return _mainRuntime;
+    return mainRuntime;
   }
 
 private:
-  static jsi::Runtime *_mainRuntime;
+  // Replaced from the JS thread when the app is reloaded, while secondary
+  // runtimes may be reading it
+  static std::atomic<jsi::Runtime *> _mainRuntime;
+  static std::atomic<uint64_t> _nextCacheId;
 };
 
 /**
@@ -49,20 +66,50 @@ private:
  * The above assumption makes it work without any overhead when only single
  * runtime is in use. Specifically, we don't perform any additional operations
  * related to tracking runtime lifecycle when only a single runtime is used.
+ *
+ * Secondary runtimes (e.g. a worklet runtime drawing on the UI thread) are
+ * served from a small per thread table remembering the last value returned
+ * for each cache, so that repeated lookups do not take the lock or hash the
+ * runtime pointer.
  */
 template <typename T>
 class RuntimeAwareCache : public BaseRuntimeAwareCache,
                           public RuntimeLifecycleListener {
 
 public:
+  RuntimeAwareCache() : _id(nextCacheId()) {}
+
+  /**
+   * Caches that are shared between host object instances (like the per class
+   * lookup tables) are not destroyed together with the objects using them, and
+   * will outlive the main runtime when the app is reloaded. Pass true to also
+   * track the lifetime of the main runtime so that its values are released
+   * when it is torn down.
+   */
+  explicit RuntimeAwareCache(bool trackMainRuntime)
+      : _id(nextCacheId()), _trackMainRuntime(trackMainRuntime) {}
+
   void onRuntimeDestroyed(jsi::Runtime *rt) override {
-    if (getMainJsRuntime() != rt) {
+    // Runtimes are destroyed on their own threads, so the tracked main
+    // runtime is only replaced or released under the lock
+    std::lock_guard<std::mutex> lock(_secondaryMutex);
+    if (_primaryRuntime.load(std::memory_order_acquire) == rt) {
+      // We are removing a tracked main runtime
+      _primaryCache = T();
+      _primaryRuntime.store(nullptr, std::memory_order_release);
+    } else if (getMainJsRuntime() != rt) {
       // We are removing a secondary runtime
+      // Invalidate the thread slots before the value they point to goes away
+      _generation.fetch_add(1, std::memory_order_release);
       _secondaryRuntimeCaches.erase(rt);
     }
   }
 
   ~RuntimeAwareCache() {
+    auto primaryRuntime = _primaryRuntime.load(std::memory_order_acquire);
+    if (primaryRuntime != nullptr) {
+      RuntimeLifecycleMonitor::removeListener(*primaryRuntime, this);
+    }
     for (auto &cache : _secondaryRuntimeCaches) {
       RuntimeLifecycleMonitor::removeListener(
           *static_cast<jsi::Runtime *>(cache.first), this);
@@ -74,28 +121,91 @@ public:
     // to avoid us having to lookup by runtime for caches that only has a single
     // runtime
     if (getMainJsRuntime() == &rt) {
-      return _primaryCache;
-    } else {
-      if (_secondaryRuntimeCaches.count(&rt) == 0) {
-        // we only add listener when the secondary runtime is used, this assumes
-        // that the secondary runtime is terminated first. This lets us avoid
-        // additional complexity for the majority of cases when objects are not
-        // shared between runtimes. Otherwise we'd have to register all objecrts
-        // with the RuntimeMonitor as opposed to only registering ones that are
-        // used in secondary runtime. Note that we can't register listener here
-        // with the primary runtime as it may run on a separate thread.
-        RuntimeLifecycleMonitor::addListener(rt, this);
-
-        T cache;
-        _secondaryRuntimeCaches.emplace(&rt, std::move(cache));
+      if (_trackMainRuntime &&
+          _primaryRuntime.load(std::memory_order_acquire) != &rt) {
+        trackMainRuntime(rt);
       }
+      return _primaryCache;
+    }
+    // A runtime is only used from one thread at a time, so a value found in
+    // this thread's slot can't be erased while we are using it.
+    auto &slot = threadSlots()[_id % ThreadSlotCount];
+    auto generation = _generation.load(std::memory_order_acquire);
+    if (slot.cacheId == _id && slot.runtime == &rt &&
+        slot.generation == generation) {
+      return *slot.value;
     }
-    return _secondaryRuntimeCaches.at(&rt);
+    auto &value = getSecondary(rt);
+    slot = {_id, &rt, generation, &value};
+    return value;
   }
 
 private:
+  static constexpr size_t ThreadSlotCount = 16;
+
+  /**
+   Last value returned on the current thread by the cache with the given id
+   */
+  struct ThreadSlot {
+    uint64_t cacheId = 0;
+    jsi::Runtime *runtime = nullptr;
+    uint64_t generation = 0;
+    T *value = nullptr;
+  };
+
+  static std::array<ThreadSlot, ThreadSlotCount> &threadSlots() {
+    static thread_local std::array<ThreadSlot, ThreadSlotCount> slots;
+    return slots;
+  }
+
+  T &getSecondary(jsi::Runtime &rt) {
+    // Secondary runtimes may live on other threads than the main runtime, and
+    // a shared cache can be accessed from several of them at the same time.
+    std::lock_guard<std::mutex> lock(_secondaryMutex);
+    auto cache = _secondaryRuntimeCaches.find(&rt);
+    if (cache == _secondaryRuntimeCaches.end()) {
+      // we only add listener when the secondary runtime is used, this assumes
+      // that the secondary runtime is terminated first. This lets us avoid
+      // additional complexity for the majority of cases when objects are not
+      // shared between runtimes. Otherwise we'd have to register all objecrts
+      // with the RuntimeMonitor as opposed to only registering ones that are
+      // used in secondary runtime. Note that we can't register listener here
+      // with the primary runtime as it may run on a separate thread.
+      RuntimeLifecycleMonitor::addListener(rt, this);
+
+      T newCache;
+      cache = _secondaryRuntimeCaches.emplace(&rt, std::move(newCache)).first;
+    }
+    return cache->second;
+  }
+
+  /**
+   Starts tracking the main runtime. If the main runtime was replaced while the
+   previous one is still alive, the values belonging to the previous runtime
+   are moved to the secondary caches so that they are released together with
+   their runtime.
+   */
+  void trackMainRuntime(jsi::Runtime &rt) {
+    RuntimeLifecycleMonitor::addListener(rt, this);
+    std::lock_guard<std::mutex> lock(_secondaryMutex);
+    auto previousRuntime = _primaryRuntime.load(std::memory_order_acquire);
+    if (previousRuntime != nullptr) {
+      _secondaryRuntimeCaches.emplace(previousRuntime,
+                                      std::move(_primaryCache));
+      _primaryCache = T();
+    }
+    _primaryRuntime.store(&rt, std::memory_order_release);
+  }
+
+  const uint64_t _id;
+  // Changed whenever a secondary value is erased
+  std::atomic<uint64_t> _generation = {0};
   std::unordered_map<void *, T> _secondaryRuntimeCaches;
+  std::mutex _secondaryMutex;
   T _primaryCache;
+  bool _trackMainRuntime = false;
+  // Read by onRuntimeDestroyed on the thread of any runtime
+  std::atomic<jsi::Runtime *> _primaryRuntime = {nullptr};
 };
 
 } // namespace RNJsi
@@ -1,5 +1,6 @@
 #include "RuntimeLifecycleMonitor.h"
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -10,22 +11,32 @@ static std::unordered_map<jsi::Runtime *,
                           std::unordered_set<RuntimeLifecycleListener *>>
     listeners;
 
+// Listeners can be added from any runtime's thread
+static std::mutex listenersMutex;
+
 struct RuntimeLifecycleMonitorObject : public jsi::HostObject {
   jsi::Runtime *_rt;
   explicit RuntimeLifecycleMonitorObject(jsi::Runtime *rt) : _rt(rt) {}
   ~RuntimeLifecycleMonitorObject() {
-    auto listenersSet = listeners.find(_rt);
-    if (listenersSet != listeners.end()) {
-      for (auto listener : listenersSet->second) {
-        listener->onRuntimeDestroyed(_rt);
+    std::unordered_set<RuntimeLifecycleListener *> listenersSet;
+    {
+      std::lock_guard<std::mutex> lock(listenersMutex);
+      auto it = listeners.find(_rt);
+      if (it == listeners.end()) {
+        return;
       }
-      listeners.erase(listenersSet);
+      listenersSet = std::move(it->second);
+      listeners.erase(it);
+    }
+    for (auto listener : listenersSet) {
+      listener->onRuntimeDestroyed(_rt);
     }
   }
 };
 
 void RuntimeLifecycleMonitor::addListener(jsi::Runtime &rt,
                                           RuntimeLifecycleListener *listener) {
+  std::lock_guard<std::mutex> lock(listenersMutex);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // We install a global host object in the provided runtime, this way we can
@@ -46,6 +57,7 @@ void RuntimeLifecycleMonitor::addListener(jsi::Runtime &rt,
 
 void RuntimeLifecycleMonitor::removeListener(
     jsi::Runtime &rt, RuntimeLifecycleListener *listener) {
+  std::lock_guard<std::mutex> lock(listenersMutex);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // nothing to do here
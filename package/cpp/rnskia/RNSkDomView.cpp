@@ -38,9 +38,14 @@ bool RNSkDomRenderer::tryRender(
   if (_renderLock->try_lock()) {
     // If we have a Dom Node we can render directly on the main thread
     if (_root != nullptr) {
-      canvasProvider->renderToCanvas(std::bind(
-          &RNSkDomRenderer::renderCanvas, this, std::placeholders::_1,
-          canvasProvider->getScaledWidth(), canvasProvider->getScaledHeight()));
+      // Captures little enough for std::function to store it without
+      // allocating, unlike a bound member function
+      auto width = canvasProvider->getScaledWidth();
+      auto height = canvasProvider->getScaledHeight();
+      _isPreservingContents = canvasProvider->isPreservingContents();
+      canvasProvider->renderToCanvas([this, width, height](SkCanvas *canvas) {
+        renderCanvas(canvas, width, height, false);
+      });
     }
 
     _renderLock->unlock();
@@ -56,7 +61,8 @@ void RNSkDomRenderer::renderImmediate(
   setShowDebugOverlays(false);
   canvasProvider->renderToCanvas(std::bind(
       &RNSkDomRenderer::renderCanvas, this, std::placeholders::_1,
-      canvasProvider->getScaledWidth(), canvasProvider->getScaledHeight()));
+      canvasProvider->getScaledWidth(), canvasProvider->getScaledHeight(),
+      true));
   setShowDebugOverlays(prevDebugOverlay);
 }
 
@@ -67,6 +73,7 @@ void RNSkDomRenderer::setRoot(std::shared_ptr<JsiDomRenderNode> node) {
     _root = nullptr;
   }
   _root = node;
+  _isFullRedrawRequired = true;
 }
 
 void RNSkDomRenderer::setOnTouchCallback(
@@ -75,13 +82,10 @@ void RNSkDomRenderer::setOnTouchCallback(
 }
 
 void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
-                                   float scaledHeight) {
+                                   float scaledHeight, bool isImmediate) {
   _renderTimingInfo.beginTiming();
 
   auto pd = _platformContext->getPixelDensity();
-  canvas->clear(SK_ColorTRANSPARENT);
-  canvas->save();
-  canvas->scale(pd, pd);
 
   if (_drawingContext == nullptr) {
     _drawingContext = std::make_shared<DrawingContext>();
@@ -98,15 +102,31 @@ void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
   _drawingContext->setScaledHeight(scaledHeight);
 
   // Update canvas before drawing
-  _drawingContext->setCanvas(canvas);
+  _drawingContext->setDeviceCanvas(canvas);
+  _drawingContext->resetCulledNodeCounts();
 
+  auto frameTarget = FrameTarget::None;
   try {
     // Ask the root node to render to the provided canvas
     std::lock_guard<std::mutex> lock(_rootLock);
     if (_root != nullptr) {
-      _root->commitPendingChanges();
-      _root->render(_drawingContext.get());
+      _committedNodeCount = _root->commitPendingChanges();
+      if (isImmediate) {
+        // Changes committed here are not on the frame surface, and the
+        // bounds of the changed nodes are not measured
+        _isFullRedrawRequired = true;
+        canvas->clear(SK_ColorTRANSPARENT);
+        SkAutoCanvasRestore autoRestore(canvas, true);
+        canvas->scale(pd, pd);
+        _drawingContext->setCanvas(canvas);
+        _root->render(_drawingContext.get());
+      } else {
+        frameTarget = drawFrame(canvas, pd);
+      }
       _root->resetPendingChanges();
+    } else {
+      _isFullRedrawRequired = true;
+      canvas->clear(SK_ColorTRANSPARENT);
     }
   } catch (std::runtime_error err) {
     _platformContext->raiseError(err);
@@ -117,13 +137,146 @@ void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
         std::runtime_error("Error rendering the Skia view."));
   }
 
-  renderDebugOverlays(canvas);
+  _damageCulledNodeCount = _drawingContext->getDamageCulledNodeCount();
+  _clipCulledNodeCount = _drawingContext->getClipCulledNodeCount();
+  // Images of disposed nodes are released here on the render thread
+  _drawingContext->getRasterCache()->purge();
+  _drawingContext->endMeasuring();
+  _drawingContext->setCullingToDamage(false);
+  _drawingContext->setCanvas(nullptr);
+  _drawingContext->setDeviceCanvas(nullptr);
+
+  if (frameTarget == FrameTarget::FrameSurface) {
+    // The canvas doesn't keep its contents between frames, so the frame
+    // surface is copied in full even if only part of it was redrawn
+    canvas->clear(SK_ColorTRANSPARENT);
+    canvas->drawImage(_frameSurface->makeImageSnapshot(), 0, 0);
+  } else if (frameTarget == FrameTarget::None && !isImmediate) {
+    // The bounds measured by a failed frame can't be trusted
+    _isFullRedrawRequired = true;
+  }
 
+  canvas->save();
+  canvas->scale(pd, pd);
+  renderDebugOverlays(canvas);
   canvas->restore();
 
   _renderTimingInfo.stopTiming();
 }
 
+RNSkDomRenderer::FrameTarget RNSkDomRenderer::drawFrame(SkCanvas *canvas,
+                                                        float pd) {
+  auto size = canvas->getBaseLayerSize();
+  auto bounds = SkRect::Make(size);
+  auto isFullRedraw = _isFullRedrawRequired.exchange(false);
+  if (_measureCanvas == nullptr ||
+      _measureCanvas->getBaseLayerSize() != size) {
+    _measureCanvas =
+        std::make_unique<SkNoDrawCanvas>(size.width(), size.height());
+    isFullRedraw = true;
+  }
+
+  // When every frame is damaged in full, as in a fully animated scene,
+  // measuring them is wasted. They are drawn straight to the canvas until a
+  // frame is measured again to find whether the damage became partial.
+  if (_fullDamageFrameCount >= FullDamageFramesBeforeSkippingMeasure) {
+    if (_unmeasuredFrameCount < UnmeasuredFramesBetweenProbes) {
+      _unmeasuredFrameCount++;
+      // The bounds cached by the nodes miss the changes of this frame
+      _isFullRedrawRequired = true;
+      _isFrameSurfaceStale = true;
+      _damagedPercentage = 100;
+      drawDamage(canvas, bounds, pd, false);
+      return FrameTarget::Canvas;
+    }
+    // This frame measures all nodes, the next one finds the damage
+    _unmeasuredFrameCount = 0;
+    _fullDamageFrameCount = FullDamageFramesBeforeSkippingMeasure - 1;
+  }
+
+  // Measure the bounds of the changed nodes to find the damage of the frame.
+  // Unchanged subtrees report their cached bounds without being visited.
+  {
+    SkAutoCanvasRestore autoRestore(_measureCanvas.get(), true);
+    _measureCanvas->scale(pd, pd);
+    _drawingContext->setCanvas(_measureCanvas.get());
+    _drawingContext->beginMeasuring(isFullRedraw);
+    _root->render(_drawingContext.get());
+    _drawingContext->endMeasuring();
+  }
+
+  auto damage = bounds;
+  auto isMeasuredDamage = false;
+  if (!isFullRedraw && !_drawingContext->hasFullDamage()) {
+    damage = _drawingContext->getDamage();
+    isMeasuredDamage = true;
+    if (!damage.intersect(bounds)) {
+      damage.setEmpty();
+    } else if (_root->subtreeReadsBackdrop()) {
+      // Backdrop filters change with anything drawn below them
+      damage = bounds;
+      isMeasuredDamage = false;
+    }
+  }
+  auto isFullDamage = damage.contains(bounds);
+  if (!isFullRedraw) {
+    // Full redraws that were required say nothing about the scene
+    _fullDamageFrameCount = isFullDamage ? _fullDamageFrameCount + 1 : 0;
+  }
+  auto area = bounds.width() * bounds.height();
+  _damagedPercentage =
+      area > 0 ? 100 * damage.width() * damage.height() / area : 0;
+
+  // Canvases keeping their contents have the damaged region redrawn in place,
+  // and frames damaged in full don't need the previous frame.
+  if (_isPreservingContents || isFullDamage) {
+    if (!damage.isEmpty()) {
+      drawDamage(canvas, damage, pd, isMeasuredDamage && !isFullDamage);
+    }
+    _isFrameSurfaceStale = true;
+    return FrameTarget::Canvas;
+  }
+
+  // Otherwise the previous frame is kept on the frame surface and only the
+  // damaged region of it is redrawn
+  if (_frameSurface == nullptr || _frameSurface->width() != size.width() ||
+      _frameSurface->height() != size.height()) {
+    auto info = SkImageInfo::MakeN32Premul(size.width(), size.height());
+    _frameSurface = canvas->makeSurface(info);
+    if (_frameSurface == nullptr) {
+      _frameSurface = SkSurface::MakeRaster(info);
+    }
+    _isFrameSurfaceStale = true;
+  }
+  if (_frameSurface == nullptr) {
+    _damagedPercentage = 100;
+    drawDamage(canvas, bounds, pd, false);
+    return FrameTarget::Canvas;
+  }
+  if (_isFrameSurfaceStale) {
+    damage = bounds;
+    isMeasuredDamage = false;
+    _isFrameSurfaceStale = false;
+  }
+  if (!damage.isEmpty()) {
+    drawDamage(_frameSurface->getCanvas(), damage, pd, isMeasuredDamage);
+  }
+  return FrameTarget::FrameSurface;
+}
+
+void RNSkDomRenderer::drawDamage(SkCanvas *canvas, const SkRect &damage,
+                                 float pd, bool isCullingToDamage) {
+  // Subtrees outside of the measured damage are skipped
+  SkAutoCanvasRestore autoRestore(canvas, true);
+  canvas->clipRect(damage);
+  canvas->clear(SK_ColorTRANSPARENT);
+  canvas->scale(pd, pd);
+  _drawingContext->setCanvas(canvas);
+  _drawingContext->setCullingToDamage(isCullingToDamage);
+  _root->render(_drawingContext.get());
+  _drawingContext->setCullingToDamage(false);
+}
+
 void RNSkDomRenderer::updateTouches(std::vector<RNSkTouchInfo> &touches) {
   std::lock_guard<std::mutex> lock(_touchMutex);
   // Add timestamp
@@ -203,7 +356,12 @@ void RNSkDomRenderer::renderDebugOverlays(SkCanvas *canvas) {
   // Build string
   std::ostringstream stream;
   stream << "render: " << renderAvg << "ms"
-         << " fps: " << fps;
+         << " fps: " << fps
+         << " committed nodes: " << _committedNodeCount.load()
+         << " culled nodes: " << _damageCulledNodeCount.load() << " damage, "
+         << _clipCulledNodeCount.load() << " clip"
+         << " damaged: " << static_cast<int>(_damagedPercentage.load())
+         << "%";
 
   std::string debugString = stream.str();
 
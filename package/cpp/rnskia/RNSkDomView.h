@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -21,9 +22,9 @@
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
 
-#include <SkBBHFactory.h>
 #include <SkCanvas.h>
-#include <SkPictureRecorder.h>
+#include <SkNoDrawCanvas.h>
+#include <SkSurface.h>
 
 #pragma clang diagnostic pop
 
@@ -54,9 +55,33 @@ public:
 
   void updateTouches(std::vector<RNSkTouchInfo> &touches);
 
+  /**
+   Returns the number of nodes visited by the commit pass of the last frame
+   */
+  size_t getCommittedNodeCount() const { return _committedNodeCount; }
+
+  /**
+   Returns the number of subtrees the last frame skipped since they were
+   outside of the damaged region
+   */
+  size_t getDamageCulledNodeCount() const { return _damageCulledNodeCount; }
+
+  /**
+   Returns the number of nodes the last frame didn't draw since they were
+   outside of the clip, as when they are off the canvas
+   */
+  size_t getClipCulledNodeCount() const { return _clipCulledNodeCount; }
+
 private:
+  // Where a frame was drawn, None if it failed
+  enum class FrameTarget { None, Canvas, FrameSurface };
+
   void callOnTouch();
-  void renderCanvas(SkCanvas *canvas, float scaledWidth, float scaledHeight);
+  void renderCanvas(SkCanvas *canvas, float scaledWidth, float scaledHeight,
+                    bool isImmediate);
+  FrameTarget drawFrame(SkCanvas *canvas, float pd);
+  void drawDamage(SkCanvas *canvas, const SkRect &damage, float pd,
+                  bool isCullingToDamage);
   void renderDebugOverlays(SkCanvas *canvas);
 
   std::shared_ptr<RNSkPlatformContext> _platformContext;
@@ -69,6 +94,27 @@ private:
   std::shared_ptr<DrawingContext> _drawingContext;
 
   RNSkTimingInfo _renderTimingInfo;
+  std::atomic<size_t> _committedNodeCount = {0};
+  std::atomic<size_t> _damageCulledNodeCount = {0};
+  std::atomic<size_t> _clipCulledNodeCount = {0};
+
+  // Number of frames in a row damaged in full before frames are drawn
+  // without measuring them
+  static constexpr size_t FullDamageFramesBeforeSkippingMeasure = 3;
+  // Number of frames drawn without measuring them before measuring again
+  static constexpr size_t UnmeasuredFramesBetweenProbes = 30;
+
+  // Holds the previous frame so that only the damaged region is redrawn, for
+  // canvases that don't keep their contents between frames
+  sk_sp<SkSurface> _frameSurface;
+  bool _isFrameSurfaceStale = true;
+  bool _isPreservingContents = false;
+  // Canvas the bounds of changed nodes are measured on, without drawing
+  std::unique_ptr<SkNoDrawCanvas> _measureCanvas;
+  std::atomic<bool> _isFullRedrawRequired = {true};
+  std::atomic<float> _damagedPercentage = {0};
+  size_t _fullDamageFrameCount = 0;
+  size_t _unmeasuredFrameCount = 0;
 
   std::mutex _touchMutex;
   std::vector<std::vector<RNSkTouchInfo>> _currentTouches;
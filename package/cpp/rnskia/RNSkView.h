@@ -46,6 +46,12 @@ public:
    */
   virtual void renderToCanvas(const std::function<void(SkCanvas *)> &) = 0;
 
+  /**
+   Returns true if the canvas still holds the previous frame when rendering to
+   it, so that only the changed part of it needs to be redrawn
+   */
+  virtual bool isPreservingContents() { return false; }
+
 protected:
   std::function<void()> _requestRedraw;
 };
@@ -127,6 +133,11 @@ public:
     cb(_surface->getCanvas());
   };
 
+  /**
+   The surface is kept between frames
+   */
+  bool isPreservingContents() override { return true; };
+
 private:
   float _width;
   float _height;
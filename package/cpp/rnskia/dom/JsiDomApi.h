@@ -4,7 +4,12 @@
 #define SKIA_DOM_DEBUG 0
 #define SKIA_DOM_DEBUG_VERBOSE 0
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "JsiHostObject.h"
 
@@ -61,108 +66,191 @@ public:
                     JsiDependencyManager::createCtor(context));
 
     // Shapes
-    installFunction("RectNode", JsiRectNode::createCtor(context));
-    installFunction("RRectNode", JsiRRectNode::createCtor(context));
-    installFunction("CircleNode", JsiCircleNode::createCtor(context));
-    installFunction("PathNode", JsiPathNode::createCtor(context));
-    installFunction("LineNode", JsiLineNode::createCtor(context));
-    installFunction("ImageNode", JsiImageNode::createCtor(context));
-    installFunction("OvalNode", JsiOvalNode::createCtor(context));
-    installFunction("PatchNode", JsiPatchNode::createCtor(context));
-    installFunction("PointsNode", JsiPointsNode::createCtor(context));
-    installFunction("DiffRectNode", JsiDiffRectNode::createCtor(context));
+    installNode<JsiRectNode>("RectNode", context);
+    installNode<JsiRRectNode>("RRectNode", context);
+    installNode<JsiCircleNode>("CircleNode", context);
+    installNode<JsiPathNode>("PathNode", context);
+    installNode<JsiLineNode>("LineNode", context);
+    installNode<JsiImageNode>("ImageNode", context);
+    installNode<JsiOvalNode>("OvalNode", context);
+    installNode<JsiPatchNode>("PatchNode", context);
+    installNode<JsiPointsNode>("PointsNode", context);
+    installNode<JsiDiffRectNode>("DiffRectNode", context);
 
-    installFunction("FillNode", JsiFillNode::createCtor(context));
+    installNode<JsiFillNode>("FillNode", context);
 
-    installFunction("GroupNode", JsiGroupNode::createCtor(context));
+    installNode<JsiGroupNode>("GroupNode", context);
 
-    installFunction("PaintNode", JsiPaintNode::createCtor(context));
+    installNode<JsiPaintNode>("PaintNode", context);
 
-    installFunction("BlurMaskFilterNode", JsiBlurMaskNode::createCtor(context));
+    installNode<JsiBlurMaskNode>("BlurMaskFilterNode", context);
 
-    installFunction("PictureNode", JsiPictureNode::createCtor(context));
-    installFunction("ImageSVGNode", JsiImageSvgNode::createCtor(context));
+    installNode<JsiPictureNode>("PictureNode", context);
+    installNode<JsiImageSvgNode>("ImageSVGNode", context);
 
-    installFunction("VerticesNode", JsiVerticesNode::createCtor(context));
+    installNode<JsiVerticesNode>("VerticesNode", context);
 
     // Path effects
-    installFunction("DashPathEffectNode",
-                    JsiDashPathEffectNode::createCtor(context));
-    installFunction("DiscretePathEffectNode",
-                    JsiDiscretePathEffectNode::createCtor(context));
-    installFunction("CornerPathEffectNode",
-                    JsiCornerPathEffectNode::createCtor(context));
-    installFunction("Path1DPathEffectNode",
-                    JsiPath1DPathEffectNode::createCtor(context));
-    installFunction("Path2DPathEffectNode",
-                    JsiPath2DPathEffectNode::createCtor(context));
-    installFunction("Line2DPathEffectNode",
-                    JsiLine2DPathEffectNode::createCtor(context));
-    installFunction("SumPathEffectNode",
-                    JsiSumPathEffectNode::createCtor(context));
+    installNode<JsiDashPathEffectNode>("DashPathEffectNode", context);
+    installNode<JsiDiscretePathEffectNode>("DiscretePathEffectNode", context);
+    installNode<JsiCornerPathEffectNode>("CornerPathEffectNode", context);
+    installNode<JsiPath1DPathEffectNode>("Path1DPathEffectNode", context);
+    installNode<JsiPath2DPathEffectNode>("Path2DPathEffectNode", context);
+    installNode<JsiLine2DPathEffectNode>("Line2DPathEffectNode", context);
+    installNode<JsiSumPathEffectNode>("SumPathEffectNode", context);
 
     // Image filters
-    installFunction("DashPathEffectNode",
-                    JsiBlendImageFilterNode::createCtor(context));
-    installFunction("DropShadowImageFilterNode",
-                    JsiDropShadowImageFilterNode::createCtor(context));
-    installFunction("DisplacementMapImageFilterNode",
-                    JsiDisplacementMapImageFilterNode::createCtor(context));
-    installFunction("BlurImageFilterNode",
-                    JsiBlurImageFilterNode::createCtor(context));
-    installFunction("OffsetImageFilterNode",
-                    JsiOffsetImageFilterNode::createCtor(context));
-    installFunction("MorphologyImageFilterNode",
-                    JsiMorphologyImageFilterNode::createCtor(context));
-    installFunction("RuntimeShaderImageFilterNode",
-                    JsiRuntimeShaderImageFilterNode::createCtor(context));
+    installNode<JsiBlendImageFilterNode>("BlendImageFilterNode", context);
+    installNode<JsiDropShadowImageFilterNode>("DropShadowImageFilterNode",
+                                              context);
+    installNode<JsiDisplacementMapImageFilterNode>(
+        "DisplacementMapImageFilterNode", context);
+    installNode<JsiBlurImageFilterNode>("BlurImageFilterNode", context);
+    installNode<JsiOffsetImageFilterNode>("OffsetImageFilterNode", context);
+    installNode<JsiMorphologyImageFilterNode>("MorphologyImageFilterNode",
+                                              context);
+    installNode<JsiRuntimeShaderImageFilterNode>("RuntimeShaderImageFilterNode",
+                                                 context);
 
     // Color Filters
-    installFunction("MatrixColorFilterNode",
-                    JsiMatrixColorFilterNode::createCtor(context));
-    installFunction("BlendColorFilterNode",
-                    JsiBlendColorFilterNode::createCtor(context));
-    installFunction("LinearToSRGBGammaColorFilterNode",
-                    JsiLinearToSRGBGammaColorFilterNode::createCtor(context));
-    installFunction("SRGBToLinearGammaColorFilterNode",
-                    JsiSRGBToLinearGammaColorFilterNode::createCtor(context));
-    installFunction("LumaColorFilterNode",
-                    JsiLumaColorFilterNode::createCtor(context));
-    installFunction("LerpColorFilterNode",
-                    JsiLerpColorFilterNode::createCtor(context));
+    installNode<JsiMatrixColorFilterNode>("MatrixColorFilterNode", context);
+    installNode<JsiBlendColorFilterNode>("BlendColorFilterNode", context);
+    installNode<JsiLinearToSRGBGammaColorFilterNode>(
+        "LinearToSRGBGammaColorFilterNode", context);
+    installNode<JsiSRGBToLinearGammaColorFilterNode>(
+        "SRGBToLinearGammaColorFilterNode", context);
+    installNode<JsiLumaColorFilterNode>("LumaColorFilterNode", context);
+    installNode<JsiLerpColorFilterNode>("LerpColorFilterNode", context);
 
     // Shaders
-    installFunction("ShaderNode", JsiShaderNode::createCtor(context));
-    installFunction("ImageShaderNode", JsiImageShaderNode::createCtor(context));
-    installFunction("ColorShaderNode", JsiColorShaderNode::createCtor(context));
-    installFunction("TurbulenceNode", JsiTurbulenceNode::createCtor(context));
-    installFunction("FractalNoiseNode",
-                    JsiFractalNoiseNode::createCtor(context));
-    installFunction("LinearGradientNode",
-                    JsiLinearGradientNode::createCtor(context));
-    installFunction("RadialGradientNode",
-                    JsiRadialGradientNode::createCtor(context));
-    installFunction("SweepGradientNode",
-                    JsiSweepGradientNode::createCtor(context));
-    installFunction("TwoPointConicalGradientNode",
-                    JsiTwoPointConicalGradientNode::createCtor(context));
-
-    installFunction("BackdropFilterNode",
-                    JsiBackdropFilterNode::createCtor(context));
-    installFunction("BlendNode", JsiBlendNode::createCtor(context));
-    installFunction("BoxNode", JsiBoxNode::createCtor(context));
-    installFunction("BoxShadowNode", JsiBoxShadowNode::createCtor(context));
-
-    installFunction("CustomDrawingNode",
-                    JsiCustomDrawingNode::createCtor(context));
-
-    installFunction("GlyphsNode", JsiGlyphsNode::createCtor(context));
-    installFunction("TextNode", JsiTextNode::createCtor(context));
-    installFunction("TextPathNode", JsiTextPathNode::createCtor(context));
-    installFunction("TextBlobNode", JsiTextBlobNode::createCtor(context));
-
-    installFunction("LayerNode", JsiLayerNode::createCtor(context));
+    installNode<JsiShaderNode>("ShaderNode", context);
+    installNode<JsiImageShaderNode>("ImageShaderNode", context);
+    installNode<JsiColorShaderNode>("ColorShaderNode", context);
+    installNode<JsiTurbulenceNode>("TurbulenceNode", context);
+    installNode<JsiFractalNoiseNode>("FractalNoiseNode", context);
+    installNode<JsiLinearGradientNode>("LinearGradientNode", context);
+    installNode<JsiRadialGradientNode>("RadialGradientNode", context);
+    installNode<JsiSweepGradientNode>("SweepGradientNode", context);
+    installNode<JsiTwoPointConicalGradientNode>("TwoPointConicalGradientNode",
+                                                context);
+
+    installNode<JsiBackdropFilterNode>("BackdropFilterNode", context);
+    installNode<JsiBlendNode>("BlendNode", context);
+    installNode<JsiBoxNode>("BoxNode", context);
+    installNode<JsiBoxShadowNode>("BoxShadowNode", context);
+
+    installNode<JsiCustomDrawingNode>("CustomDrawingNode", context);
+
+    installNode<JsiGlyphsNode>("GlyphsNode", context);
+    installNode<JsiTextNode>("TextNode", context);
+    installNode<JsiTextPathNode>("TextPathNode", context);
+    installNode<JsiTextBlobNode>("TextBlobNode", context);
+
+    installNode<JsiLayerNode>("LayerNode", context);
+
+    installFunction("createTree", JSI_HOST_FUNCTION_LAMBDA {
+      return createTree(runtime, thisValue, arguments, count);
+    });
   }
+
+  /**
+   Creates a whole subtree of nodes in a single call. The description of a node
+   is an array of the node type, using the names of the node constructors, and
+   optionally its props, the descriptions of its children and whether the node
+   should be returned: [type, props?, children?, keep?]. Returns an array with
+   the root node followed by the kept nodes in depth-first order. Nodes are not
+   subscribed to a DependencyManager, so animated props are rejected and nodes
+   with animated props must be created with their constructors.
+   */
+  JSI_HOST_FUNCTION(createTree) {
+    auto description = getArgumentAsArray(runtime, arguments, count, 0);
+    std::vector<std::shared_ptr<JsiDomNode>> kept;
+    auto root = createNode(runtime, description, kept);
+
+    auto result = jsi::Array(runtime, kept.size() + 1);
+    result.setValueAtIndex(
+        runtime, 0,
+        jsi::Object::createFromHostObject(runtime, std::move(root)));
+    for (size_t i = 0; i < kept.size(); ++i) {
+      result.setValueAtIndex(
+          runtime, i + 1,
+          jsi::Object::createFromHostObject(runtime, std::move(kept[i])));
+    }
+    return result;
+  }
+
+private:
+  /**
+   Installs the constructor of a node type and registers it for createTree
+   */
+  template <class TNode>
+  void installNode(const char *name,
+                   std::shared_ptr<RNSkPlatformContext> context) {
+    installFunction(name, TNode::createCtor(context));
+    _nodeFactories.emplace(
+        name, [context]() { return std::make_shared<TNode>(context); });
+  }
+
+  std::shared_ptr<JsiDomNode>
+  createNode(jsi::Runtime &runtime, const jsi::Array &description,
+             std::vector<std::shared_ptr<JsiDomNode>> &kept) {
+    auto size = description.size(runtime);
+    if (size == 0) {
+      throw jsi::JSError(runtime, "Expected a node type in node description.");
+    }
+    auto type = description.getValueAtIndex(runtime, 0).asString(runtime);
+    auto factory = _nodeFactories.find(type.utf8(runtime));
+    if (factory == _nodeFactories.end()) {
+      throw jsi::JSError(runtime,
+                         "Unknown node type \"" + type.utf8(runtime) + "\".");
+    }
+
+    auto props = size > 1 ? description.getValueAtIndex(runtime, 1)
+                          : jsi::Value::undefined();
+    if (props.isObject()) {
+      auto object = props.asObject(runtime);
+      auto names = object.getPropertyNames(runtime);
+      auto nameCount = names.size(runtime);
+      for (size_t i = 0; i < nameCount; ++i) {
+        auto name = names.getValueAtIndex(runtime, i).asString(runtime);
+        if (JsiDependencyManager::isAnimatedProp(
+                runtime, object.getProperty(runtime, name))) {
+          throw jsi::JSError(runtime, "Animated prop \"" + name.utf8(runtime) +
+                                          "\" is not supported by createTree.");
+        }
+      }
+    }
+
+    auto node = factory->second();
+    node->initializeNode(runtime, jsi::Value::undefined(), &props,
+                         props.isUndefined() ? 0 : 1);
+
+    if (size > 3) {
+      auto keep = description.getValueAtIndex(runtime, 3);
+      if (keep.isBool() && keep.getBool()) {
+        kept.push_back(node);
+      }
+    }
+
+    if (size > 2) {
+      auto children = description.getValueAtIndex(runtime, 2);
+      if (children.isObject()) {
+        auto array = children.asObject(runtime).asArray(runtime);
+        auto childCount = array.size(runtime);
+        for (size_t i = 0; i < childCount; ++i) {
+          auto child = array.getValueAtIndex(runtime, i)
+                           .asObject(runtime)
+                           .asArray(runtime);
+          node->addChild(createNode(runtime, child, kept));
+        }
+      }
+    }
+    return node;
+  }
+
+  std::unordered_map<std::string,
+                     std::function<std::shared_ptr<JsiDomNode>()>>
+      _nodeFactories;
 };
 
 } // namespace RNSkia
@@ -4,6 +4,7 @@
 #include "JsiValue.h"
 
 #include <string>
+#include <vector>
 
 namespace RNSkia {
 
@@ -50,6 +51,12 @@ public:
   virtual void readValueFromJs(jsi::Runtime &runtime,
                                const ReadPropFunc &read) = 0;
 
+  /**
+   Appends the properties reading a value by name, ie. this property or its
+   child properties, to the list
+   */
+  virtual void collectNodeProps(std::vector<NodeProp *> &props) = 0;
+
   /**
    Returns the name (or names) in a property
    */
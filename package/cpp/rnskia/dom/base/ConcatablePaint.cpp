@@ -6,11 +6,9 @@
 
 namespace RNSkia {
 
-ConcatablePaint::ConcatablePaint(
-    DeclarationContext *declarationContext, PaintProps *paintProps,
-    const std::vector<std::shared_ptr<JsiDomNode>> &children)
-    : _declarationContext(declarationContext), _paintProps(paintProps),
-      _children(children) {
+ConcatablePaint::ConcatablePaint(DeclarationContext *declarationContext,
+                                 PaintProps *paintProps, JsiDomNode *node)
+    : _declarationContext(declarationContext), _paintProps(paintProps) {
 
   auto hasPropertyValues = _paintProps->getColor()->isSet() ||
                            _paintProps->getStrokeWidth()->isSet() ||
@@ -24,7 +22,7 @@ ConcatablePaint::ConcatablePaint(
 
   _declarationContext->save();
 
-  for (auto &child : _children) {
+  for (auto &child : node->getChildren()) {
     child->decorateContext(_declarationContext);
   }
 
@@ -27,14 +27,13 @@ class DeclarationContext;
 class ConcatablePaint {
 public:
   ConcatablePaint(DeclarationContext *context, PaintProps *paintProps,
-                  const std::vector<std::shared_ptr<JsiDomNode>> &children);
+                  JsiDomNode *node);
 
   void concatTo(std::shared_ptr<SkPaint> paint);
   bool isEmpty();
 
 private:
   DeclarationContext *_declarationContext;
-  const std::vector<std::shared_ptr<JsiDomNode>> _children;
   PaintProps *_paintProps;
 
   bool _isEmpty{true};
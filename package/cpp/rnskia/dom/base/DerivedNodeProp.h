@@ -63,6 +63,15 @@ public:
     }
   }
 
+  /**
+   Delegate collecting properties to child nodes
+   */
+  void collectNodeProps(std::vector<NodeProp *> &props) override {
+    for (auto &prop : _properties) {
+      prop->collectNodeProps(props);
+    }
+  }
+
   /**
    Override to calculate the derived value from child properties
    */
@@ -4,52 +4,127 @@
 #include "JsiDomNode.h"
 #include "PaintProps.h"
 
+#include <atomic>
 #include <numeric>
+#include <utility>
 
 namespace RNSkia {
 
-DrawingContext::DrawingContext(std::shared_ptr<SkPaint> paint) {
+DrawingContext::DrawingContext(std::shared_ptr<SkPaint> paint)
+    : _rootPaint(std::move(paint)) {
   _declarationContext = std::make_unique<DeclarationContext>();
-  paint->setAntiAlias(true);
-  _paints.push_back(paint);
+  _rootPaint->setAntiAlias(true);
+  _paints.reserve(InitialPaintStackDepth);
+  _paints.push_back({_rootPaint.get(), nextPaintVersion()});
 }
 
 DrawingContext::DrawingContext()
     : DrawingContext(std::make_shared<SkPaint>()) {}
 
-bool DrawingContext::saveAndConcat(
-    PaintProps *paintProps,
-    const std::vector<std::shared_ptr<JsiDomNode>> &children,
-    std::shared_ptr<SkPaint> paintCache) {
-
-  if (paintCache) {
-    _paints.push_back(paintCache);
-    return true;
+bool DrawingContext::compilePaint(PaintProps *paintProps, JsiDomNode *node,
+                                  std::shared_ptr<SkPaint> &paint) {
+  ConcatablePaint concatablePaint(_declarationContext.get(), paintProps, node);
+  if (concatablePaint.isEmpty()) {
+    return false;
   }
-
-  ConcatablePaint paint(_declarationContext.get(), paintProps, children);
-  if (!paint.isEmpty()) {
-    save();
-    paint.concatTo(getPaint());
-    return true;
+  if (paint == nullptr) {
+    paint = std::make_shared<SkPaint>();
   }
-
-  return false;
+  *paint = *getPaint();
+  concatablePaint.concatTo(paint);
+  return true;
 }
 
-void DrawingContext::save() {
-  // Copy paint and push
-  _paints.push_back(std::make_shared<SkPaint>(*getPaint()));
+void DrawingContext::pushPaint(SkPaint *paint, size_t version) {
+  _paints.push_back({paint, version});
 }
 
 void DrawingContext::restore() { _paints.pop_back(); }
 
+size_t DrawingContext::getPaintVersion() { return _paints.back().version; }
+
+size_t DrawingContext::nextPaintVersion() {
+  static std::atomic<size_t> version = {1};
+  return version++;
+}
+
 SkCanvas *DrawingContext::getCanvas() { return _canvas; }
 
 void DrawingContext::setCanvas(SkCanvas *canvas) { _canvas = canvas; }
 
-std::shared_ptr<SkPaint> DrawingContext::getPaint() {
-  return _paints[_paints.size() - 1];
+sk_sp<SkSurface> DrawingContext::makeSurface(const SkImageInfo &info) {
+  auto surface = _canvas->makeSurface(info);
+  if (surface == nullptr && _deviceCanvas != nullptr) {
+    surface = _deviceCanvas->makeSurface(info);
+  }
+  if (surface == nullptr) {
+    // Neither canvas is backed by a surface
+    surface = SkSurface::MakeRaster(info);
+  }
+  return surface;
+}
+
+void DrawingContext::beginMeasuring(bool measureAll) {
+  _isMeasuring = true;
+  _isMeasuringAll = measureAll;
+  _hasFullDamage = false;
+  _bounds.setEmpty();
+  _damage.setEmpty();
+}
+
+SkRect DrawingContext::beginBounds() {
+  auto outer = _bounds;
+  _bounds.setEmpty();
+  return outer;
+}
+
+SkRect DrawingContext::endBounds(const SkRect &outer) {
+  auto bounds = _bounds;
+  _bounds = outer;
+  _bounds.join(bounds);
+  return bounds;
+}
+
+void DrawingContext::addLocalBounds(const SkRect &bounds, const SkPaint &paint,
+                                    bool isStroked) {
+  auto matrix = _canvas->getTotalMatrix();
+  if (!paint.canComputeFastBounds() || matrix.hasPerspective()) {
+    addClipBounds();
+    return;
+  }
+  SkRect storage;
+  auto &paintBounds = isStroked
+                          ? paint.computeFastStrokeBounds(bounds, &storage)
+                          : paint.computeFastBounds(bounds, &storage);
+  auto deviceBounds = matrix.mapRect(paintBounds);
+  if (!deviceBounds.isFinite()) {
+    addClipBounds();
+    return;
+  }
+  if (deviceBounds.intersect(SkRect::Make(_canvas->getDeviceClipBounds()))) {
+    _bounds.join(deviceBounds);
+  }
+}
+
+void DrawingContext::addClipBounds() {
+  _bounds.join(SkRect::Make(_canvas->getDeviceClipBounds()));
+}
+
+void DrawingContext::addDamage(const SkRect &rect) {
+  if (!rect.isFinite()) {
+    _hasFullDamage = true;
+    return;
+  }
+  if (rect.isEmpty()) {
+    return;
+  }
+  // Include the pixels touched by anti aliased edges
+  auto bounds = SkRect::Make(rect.roundOut()).makeOutset(1, 1);
+  _damage.join(bounds);
+}
+
+SkPaint *DrawingContext::getPaint() {
+  return _paints.back().paint;
 }
 
 } // namespace RNSkia
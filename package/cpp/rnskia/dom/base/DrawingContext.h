@@ -4,6 +4,7 @@
 
 #include "Declaration.h"
 #include "DeclarationContext.h"
+#include "RasterCache.h"
 
 #include <memory>
 #include <string>
@@ -15,7 +16,9 @@
 
 #include <SkCanvas.h>
 #include <SkPaint.h>
+#include <SkRect.h>
 #include <SkRefCnt.h>
+#include <SkSurface.h>
 
 #pragma clang diagnostic pop
 
@@ -58,13 +61,31 @@ public:
   explicit DrawingContext(std::shared_ptr<SkPaint> paint);
 
   /**
-   Factory for saving/restoring the context for a node
+   Compiles the paint props and declarations of a node on top of the current
+   paint into the given paint, which is allocated the first time. Returns false
+   without touching the paint if the node doesn't change the current paint.
    */
-  bool saveAndConcat(PaintProps *paintProps,
-                     const std::vector<std::shared_ptr<JsiDomNode>> &children,
-                     std::shared_ptr<SkPaint> paintCache);
+  bool compilePaint(PaintProps *paintProps, JsiDomNode *node,
+                    std::shared_ptr<SkPaint> &paint);
+
+  /**
+   Makes a paint the current paint until restore is called. The paint is not
+   copied and must outlive the push, as compiled paints owned by nodes do.
+   */
+  void pushPaint(SkPaint *paint, size_t version);
   void restore();
 
+  /**
+   Returns the version of the current paint. A paint gets a new version each
+   time it is compiled, so an unchanged version means an unchanged paint.
+   */
+  size_t getPaintVersion();
+
+  /**
+   Returns a new paint version, unique across all drawing contexts
+   */
+  static size_t nextPaintVersion();
+
   /**
    Returns true if the current cache is changed
    */
@@ -80,10 +101,129 @@ public:
    */
   void setCanvas(SkCanvas *canvas);
 
+  /**
+   Sets the canvas the frame is finally drawn to. Offscreen surfaces are made
+   compatible with it when the current canvas is a recording canvas.
+   */
+  void setDeviceCanvas(SkCanvas *canvas) { _deviceCanvas = canvas; }
+
+  /**
+   Makes an offscreen surface compatible with the canvas being drawn to
+   */
+  sk_sp<SkSurface> makeSurface(const SkImageInfo &info);
+
+  /**
+   Returns the cache holding the rasterized node images drawn with this
+   context
+   */
+  RasterCache *getRasterCache() { return &_rasterCache; }
+
+  /**
+   Starts the measure pass of a frame. While measuring, render nodes report
+   their device space bounds instead of drawing, and changed nodes report the
+   region they damage. If measureAll is set cached bounds are not reused.
+   */
+  void beginMeasuring(bool measureAll);
+
+  /**
+   Ends the measure pass, the collected damage is kept until the next frame
+   */
+  void endMeasuring() { _isMeasuring = false; }
+
+  /**
+   Returns true while nodes should report their bounds instead of drawing
+   */
+  bool isMeasuring() { return _isMeasuring; }
+
+  /**
+   Set while measuring the subtree of a changed node. The change may have
+   moved all of the subtree, so the cached bounds of its nodes can't be used.
+   */
+  void setMeasuringAll(bool measureAll) { _isMeasuringAll = measureAll; }
+  bool isMeasuringAll() { return _isMeasuringAll; }
+
+  /**
+   Starts collecting the bounds of a subtree. Returns the bounds collected so
+   far, which must be passed to endBounds.
+   */
+  SkRect beginBounds();
+
+  /**
+   Returns the bounds collected since beginBounds and adds them to the outer
+   bounds
+   */
+  SkRect endBounds(const SkRect &outer);
+
+  /**
+   Adds device space bounds to the bounds being collected
+   */
+  void addBounds(const SkRect &bounds) { _bounds.join(bounds); }
+
+  /**
+   Adds the device space bounds of local geometry drawn with the paint,
+   including the space needed by the paint's stroke and filters
+   */
+  void addLocalBounds(const SkRect &bounds, const SkPaint &paint,
+                      bool isStroked);
+
+  /**
+   Adds the device space clip bounds, for drawing with unknown bounds
+   */
+  void addClipBounds();
+
+  /**
+   Adds a device space rect to the damage of the frame
+   */
+  void addDamage(const SkRect &rect);
+
+  /**
+   Returns true if the whole frame must be redrawn
+   */
+  bool hasFullDamage() { return _hasFullDamage; }
+
+  /**
+   Returns the damage collected for the frame
+   */
+  const SkRect &getDamage() { return _damage; }
+
+  /**
+   Set while drawing the damaged region of a frame, render nodes whose bounds
+   don't intersect the damage are skipped. Cleared while recording pictures
+   that are replayed in other frames.
+   */
+  void setCullingToDamage(bool culling) { _isCullingToDamage = culling; }
+  bool isCullingToDamage() { return _isCullingToDamage; }
+
+  /**
+   Set while a subtree is recorded into a picture. Descendants are recorded
+   as part of that picture and don't record pictures of their own.
+   */
+  void setRecording(bool recording) { _isRecording = recording; }
+  bool isRecording() { return _isRecording; }
+
+  /**
+   Counts the subtrees skipped because they were outside of the damage of the
+   frame
+   */
+  void addDamageCulledNode() { _damageCulledNodeCount++; }
+  size_t getDamageCulledNodeCount() { return _damageCulledNodeCount; }
+
+  /**
+   Counts the nodes not drawn because they were outside of the clip, as when
+   they are off the canvas
+   */
+  void addClipCulledNode() { _clipCulledNodeCount++; }
+  size_t getClipCulledNodeCount() { return _clipCulledNodeCount; }
+
+  void resetCulledNodeCounts() {
+    _damageCulledNodeCount = 0;
+    _clipCulledNodeCount = 0;
+  }
+
   /**
    Gets the paint object
    */
-  std::shared_ptr<SkPaint> getPaint();
+  SkPaint *getPaint();
 
   /*
    Returns the root declaratiins object
@@ -93,12 +233,33 @@ public:
   }
 
 private:
-  void save();
+  struct PaintEntry {
+    SkPaint *paint;
+    size_t version;
+  };
+
+  // Depth of the paint stack reserved up front, the stack only grows for
+  // trees nesting more paints than this
+  static constexpr size_t InitialPaintStackDepth = 32;
 
   explicit DrawingContext(const char *source);
   SkCanvas *_canvas = nullptr;
-  std::vector<std::shared_ptr<SkPaint>> _paints;
+  SkCanvas *_deviceCanvas = nullptr;
+  bool _isMeasuring = false;
+  bool _isMeasuringAll = false;
+  bool _isCullingToDamage = false;
+  bool _isRecording = false;
+  bool _hasFullDamage = false;
+  size_t _damageCulledNodeCount = 0;
+  size_t _clipCulledNodeCount = 0;
+  // Bounds of the subtree being measured
+  SkRect _bounds = SkRect::MakeEmpty();
+  SkRect _damage = SkRect::MakeEmpty();
+  // Paint the context was created with, at the bottom of the paint stack
+  std::shared_ptr<SkPaint> _rootPaint;
+  std::vector<PaintEntry> _paints;
   std::unique_ptr<DeclarationContext> _declarationContext;
+  RasterCache _rasterCache;
 };
 
 } // namespace RNSkia
@@ -5,6 +5,8 @@
 #include "RNSkPlatformContext.h"
 
 #include "JsiDomNode.h"
+#include "NodePropBinding.h"
+#include "NodePropInterpolation.h"
 
 #include <map>
 #include <memory>
@@ -15,9 +17,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameSelector = JsiPropId::get("selector");
-static PropId PropNameValue = JsiPropId::get("value");
-
 class JsiDependencyManager
     : public JsiHostObject,
       public std::enable_shared_from_this<JsiDependencyManager> {
@@ -64,9 +63,10 @@ public:
 
     // Enumerate registered keys for the given node to only handle known
     // properties
-    for (const auto &propMapping :
-         node->getPropsContainer()->getMappedProperties()) {
-      auto key = propMapping.first;
+    auto propsContainer = node->getPropsContainer();
+    for (size_t i = 0; i < propsContainer->getSlotCount(); ++i) {
+      auto propSlot = propsContainer->getSlot(i);
+      auto key = propSlot.getName();
       auto jsValue = nextProps.getProperty(runtime, key);
       JsiValue nativeValue(runtime, jsValue);
 
@@ -74,18 +74,30 @@ public:
         // Handle Skia Animation Values
         auto animatedValue = getAnimatedValue(nativeValue);
         auto unsubscribe = animatedValue->addListener(
-            [animatedValue, propMapping](jsi::Runtime &runtime) {
+            [animatedValue, propSlot](jsi::Runtime &runtime) {
               // Get value from animation value
               auto nextJsValue = animatedValue->getCurrent(runtime);
               // Update all props that listens to this animation value
-              for (auto &prop : propMapping.second) {
-                prop->updateValue(runtime, nextJsValue);
-              }
+              propSlot.updateValue(runtime, nextJsValue);
             });
 
         // Save unsubscribe methods
         unsubscribers.push_back(std::make_pair(animatedValue, unsubscribe));
 
+      } else if (isNativeSelector(nativeValue, PropNameBinding)) {
+        // Handle native bindings, the value is transformed without calling
+        // into JS
+        unsubscribers.push_back(addNativeListener(
+            nativeValue, propSlot,
+            NodePropBinding(nativeValue.getValue(PropNameBinding))));
+
+      } else if (isNativeSelector(nativeValue, PropNameInterpolation)) {
+        // Handle interpolations, evaluated natively like bindings
+        unsubscribers.push_back(addNativeListener(
+            nativeValue, propSlot,
+            NodePropInterpolation(
+                nativeValue.getValue(PropNameInterpolation))));
+
       } else if (isSelector(nativeValue)) {
         // Handle Skia Animation Value Selectors
         auto animatedValue = std::dynamic_pointer_cast<RNSkReadonlyValue>(
@@ -94,7 +106,7 @@ public:
         auto selector = nativeValue.getValue(PropNameSelector).getAsFunction();
         // Add subscription to animated value in selector
         auto unsubscribe = animatedValue->addListener(
-            [nativeValue, propMapping, selector = std::move(selector),
+            [nativeValue, propSlot, selector = std::move(selector),
              animatedValue](jsi::Runtime &runtime) {
               // Get value from animation value
               jsi::Value jsValue = animatedValue->getCurrent(runtime);
@@ -102,9 +114,7 @@ public:
               auto selectedJsValue =
                   selector(runtime, jsi::Value::null(), &jsValue, 1);
               // Update all props that listens to this animation value
-              for (auto &prop : propMapping.second) {
-                prop->updateValue(runtime, selectedJsValue);
-              }
+              propSlot.updateValue(runtime, selectedJsValue);
             });
 
         // Save unsubscribe methods
@@ -199,6 +209,25 @@ public:
                        JSI_EXPORT_FUNC(JsiDependencyManager, update),
                        JSI_EXPORT_FUNC(JsiDependencyManager, remove))
 
+  /**
+   Returns true if the JS value of a prop is an animated value or a selector,
+   which only update the node once the node is subscribed with subscribeNode
+   */
+  static bool isAnimatedProp(jsi::Runtime &runtime, const jsi::Value &value) {
+    if (!value.isObject()) {
+      return false;
+    }
+    auto object = value.asObject(runtime);
+    if (object.isHostObject(runtime)) {
+      return std::dynamic_pointer_cast<RNSkReadonlyValue>(
+                 object.getHostObject(runtime)) != nullptr;
+    }
+    return object.hasProperty(runtime, PropNameValue) &&
+           (object.hasProperty(runtime, PropNameSelector) ||
+            object.hasProperty(runtime, PropNameBinding) ||
+            object.hasProperty(runtime, PropNameInterpolation));
+  }
+
   /**
    Constructor to add to the Api object
    */
@@ -269,6 +298,35 @@ private:
         value.getAsHostObject());
   }
 
+  /**
+   Returns true if the value is a selector that also has a descriptor of its
+   transform under the given name. The descriptor is then evaluated natively
+   instead of calling the selector function.
+   */
+  bool isNativeSelector(JsiValue &value, PropId descriptor) {
+    return value.getType() == PropType::Object && value.hasValue(descriptor) &&
+           value.hasValue(PropNameValue);
+  }
+
+  /**
+   Adds a listener updating the props in the slot with the value of the
+   selector transformed by the native transform. Returns the animated value
+   and the unsubscribe function.
+   */
+  template <typename T>
+  std::pair<std::shared_ptr<RNSkReadonlyValue>, std::function<void()>>
+  addNativeListener(JsiValue &selector, NodePropSlot propSlot, T transform) {
+    auto animatedValue = std::dynamic_pointer_cast<RNSkReadonlyValue>(
+        selector.getValue(PropNameValue).getAsHostObject());
+    auto unsubscribe = animatedValue->addListener(
+        [transform = std::move(transform), propSlot,
+         animatedValue](jsi::Runtime &runtime) {
+          propSlot.updateValue(runtime,
+                               transform.apply(runtime, *animatedValue));
+        });
+    return std::make_pair(animatedValue, unsubscribe);
+  }
+
   /**
    Returns true if the value is a selector. A Selector is a JS object that has
    two properties, the selector and the the value. The selector is a function
@@ -54,7 +54,11 @@ public:
 #endif
 
     // decorate drawing context
-    decorate(context);
+    if (_declarationType == DeclarationType::Shader) {
+      decorateShader(context);
+    } else {
+      decorate(context);
+    }
 
 #if SKIA_DOM_DEBUG
     printDebugInfo("End / Commit decorate " + std::string(getType()));
@@ -68,21 +72,32 @@ public:
    */
   virtual void decorate(DeclarationContext *context) = 0;
 
-protected:
   /**
-   Invalidates and marks then context as changed. The implementation in the
-   declaration node is to pass the call upwards to the parent node
+   Overridden to release the cached shader
    */
-  void invalidateContext() override {
-    if (getParent() != nullptr) {
-      getParent()->invalidateContext();
-    }
-  }
+  void onInvalidated() override { _shaderCache = ShaderCache(); }
 
+protected:
   /**
-   A property changed
+   Declarations make the shaders and effects of the paint, and their committed
+   changes invalidate the paint of the node using them. Paint declarations
+   cache a paint of their own and shader declarations their shader, other
+   declarations are rebuilt with the paint.
    */
-  void onPropertyChanged(BaseNodeProp *prop) override { invalidateContext(); }
+  NodeInvalidationMask getPropInvalidations(PropId name) override {
+    return getDeclarationInvalidations();
+  }
+
+  NodeInvalidationMask getDeclarationInvalidations() override {
+    switch (_declarationType) {
+    case DeclarationType::Paint:
+      return InvalidatesPaint;
+    case DeclarationType::Shader:
+      return InvalidatesShader;
+    default:
+      return InvalidatesNone;
+    }
+  }
 
   /**
    Validates that only declaration nodes can be children
@@ -110,6 +125,48 @@ protected:
   }
 
 private:
+  /**
+   Pushes the shader made the last time the node was decorated, unless its
+   props or declarations changed since. Nodes that declared anything else
+   than a single shader are decorated each time.
+   */
+  void decorateShader(DeclarationContext *context) {
+    auto shaders = context->getShaders();
+    if (!consumeInvalidations(InvalidatesShader) && _shaderCache.isValid) {
+      if (_shaderCache.shader != nullptr) {
+        shaders->push(_shaderCache.shader);
+      }
+      return;
+    }
+
+    auto shaderCount = shaders->size();
+    auto otherCount = getNonShaderCount(context);
+    decorate(context);
+
+    auto isPushed = shaders->size() == shaderCount + 1;
+    _shaderCache.isValid = getNonShaderCount(context) == otherCount &&
+                           (isPushed || shaders->size() == shaderCount);
+    _shaderCache.shader = nullptr;
+    if (_shaderCache.isValid && isPushed) {
+      _shaderCache.shader = shaders->pop();
+      shaders->push(_shaderCache.shader);
+    }
+  }
+
+  static size_t getNonShaderCount(DeclarationContext *context) {
+    return context->getImageFilters()->size() +
+           context->getColorFilters()->size() +
+           context->getPathEffects()->size() +
+           context->getMaskFilters()->size() + context->getPaints()->size();
+  }
+
+  struct ShaderCache {
+    sk_sp<SkShader> shader;
+    bool isValid = false;
+  };
+
+  ShaderCache _shaderCache;
+
   /**
    Type of declaration
    */
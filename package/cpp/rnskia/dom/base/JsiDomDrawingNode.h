@@ -19,21 +19,58 @@ protected:
     _paintProp = container->defineProperty<PaintDrawingContextProp>();
   }
 
+  /**
+   Props other than the ones common to render nodes define what is drawn
+   */
+  NodeInvalidationMask getPropInvalidations(PropId name) override {
+    return isRenderNodeProp(name) ? JsiDomRenderNode::getPropInvalidations(name)
+                                  : InvalidatesGeometry | InvalidatesBounds;
+  }
+
   /**
    Override to implement drawing.
    */
   virtual void draw(DrawingContext *context) = 0;
 
+  /**
+   Override to compute the bounds of the geometry drawn by the node in local
+   coordinates, before the paint is applied. Nodes that return false are never
+   culled.
+   */
+  virtual bool computeBounds(SkRect *bounds) { return false; }
+
+  /**
+   Override to return true if the geometry is stroked whatever the paint style
+   is, as lines and points are.
+   */
+  virtual bool isAlwaysStroked() { return false; }
+
   void renderNode(DrawingContext *context) override {
 #if SKIA_DOM_DEBUG
     printDebugInfo("Begin Draw", 1);
 #endif
+    if (consumeInvalidations(InvalidatesBounds)) {
+      _hasBounds = computeBounds(&_bounds);
+    }
+
+    auto canvas = context->getCanvas();
+
     // Save paint if the paint property is set
-    if (_paintProp->isSet()) {
-      draw(_paintProp->getUnsafeDerivedValue().get());
+    auto drawingContext =
+        _paintProp->isSet() ? _paintProp->getUnsafeDerivedValue().get()
+                            : context;
+    if (context->isMeasuring()) {
+      measure(context, *drawingContext->getPaint());
+      return;
+    }
+    if (quickReject(canvas, *drawingContext->getPaint())) {
+#if SKIA_DOM_DEBUG
+      printDebugInfo("Culled", 1);
+#endif
+      context->addClipCulledNode();
     } else {
       // Call abstract draw method
-      draw(context);
+      draw(drawingContext);
     }
 
     // Draw once more for each child paint node
@@ -43,17 +80,16 @@ protected:
           std::static_pointer_cast<JsiDomDeclarationNode>(child)
                   ->getDeclarationType() == DeclarationType::Paint) {
         auto paintNode = std::static_pointer_cast<JsiPaintNode>(child);
-        // Draw once again with the paint
-        declarationCtx->save();
-        paintNode->decorate(declarationCtx);
-        auto paint = declarationCtx->getPaints()->pop();
-        declarationCtx->restore();
-
-        // FIXME: Can we avoid creating a new drawing context here each time?
-        auto localContext =
-            std::make_shared<DrawingContext>(std::shared_ptr<SkPaint>(paint));
-        localContext->setCanvas(context->getCanvas());
-        draw(localContext.get());
+        // Draw once again with the paint, which replaces the current paint
+        // until it is restored
+        auto &paint = paintNode->getPaint(declarationCtx);
+        if (quickReject(canvas, *paint)) {
+          context->addClipCulledNode();
+          continue;
+        }
+        context->pushPaint(paint.get(), paintNode->getPaintVersion());
+        draw(context);
+        context->restore();
       }
     }
 
@@ -63,7 +99,50 @@ protected:
   }
 
 private:
+  /**
+   Reports the bounds of drawing the node with its paint and with each child
+   paint node, without drawing
+   */
+  void measure(DrawingContext *context, const SkPaint &paint) {
+    addBounds(context, paint);
+    auto declarationCtx = context->getDeclarationContext();
+    for (auto &child : getChildren()) {
+      if (child->getNodeClass() == NodeClass::DeclarationNode &&
+          std::static_pointer_cast<JsiDomDeclarationNode>(child)
+                  ->getDeclarationType() == DeclarationType::Paint) {
+        auto paintNode = std::static_pointer_cast<JsiPaintNode>(child);
+        addBounds(context, *paintNode->getPaint(declarationCtx));
+      }
+    }
+  }
+
+  void addBounds(DrawingContext *context, const SkPaint &paint) {
+    if (_hasBounds) {
+      context->addLocalBounds(_bounds, paint, isAlwaysStroked());
+    } else {
+      context->addClipBounds();
+    }
+  }
+
+  /**
+   Returns true if drawing the node with the paint would not touch the clip
+   */
+  bool quickReject(SkCanvas *canvas, const SkPaint &paint) {
+    if (!_hasBounds || !paint.canComputeFastBounds()) {
+      return false;
+    }
+    SkRect storage;
+    auto &bounds = isAlwaysStroked()
+                       ? paint.computeFastStrokeBounds(_bounds, &storage)
+                       : paint.computeFastBounds(_bounds, &storage);
+    return canvas->quickReject(bounds);
+  }
+
   PaintDrawingContextProp *_paintProp;
+
+  // Local bounds of the geometry, valid if _hasBounds is set
+  SkRect _bounds = SkRect::MakeEmpty();
+  bool _hasBounds = false;
 };
 
 } // namespace RNSkia
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "JsiHostObject.h"
+#include "NodeOpQueue.h"
 #include "NodeProp.h"
 #include "NodePropsContainer.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +32,52 @@ public:
 
 static std::atomic<size_t> NodeIdent = 1000;
 
+class JsiDomNode;
+
+/**
+ Iterable view of the children of a node in order. Children are kept in an
+ intrusive doubly linked list so that inserting and removing a child given the
+ node is O(1).
+ */
+class JsiDomNodeChildren {
+public:
+  class Iterator {
+  public:
+    explicit Iterator(const std::shared_ptr<JsiDomNode> *slot) : _slot(slot) {}
+
+    const std::shared_ptr<JsiDomNode> &operator*() const { return *_slot; }
+    Iterator &operator++();
+    bool operator==(const Iterator &other) const {
+      return _slot == other._slot;
+    }
+    bool operator!=(const Iterator &other) const {
+      return _slot != other._slot;
+    }
+
+  private:
+    // Points at the link to the current child, null at the end
+    const std::shared_ptr<JsiDomNode> *_slot;
+  };
+
+  JsiDomNodeChildren(const std::shared_ptr<JsiDomNode> *first, size_t size)
+      : _first(first), _size(size) {}
+
+  Iterator begin() const { return Iterator(_size > 0 ? _first : nullptr); }
+  Iterator end() const { return Iterator(nullptr); }
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  /**
+   Returns the first child, the view must not be empty
+   */
+  const std::shared_ptr<JsiDomNode> &front() const { return *_first; }
+
+private:
+  const std::shared_ptr<JsiDomNode> *_first;
+  size_t _size;
+};
+
 typedef enum {
   RenderNode = 1,
   DeclarationNode = 2,
@@ -61,6 +109,7 @@ public:
     printDebugInfo("JsiDomNode." + std::string(_type) +
                    " DTOR - nodeId: " + std::to_string(_nodeId));
 #endif
+    unlinkChildren();
   }
 
   /**
@@ -98,13 +147,7 @@ public:
     auto propName = arguments[0].asString(runtime).utf8(runtime);
     const jsi::Value &propValue = arguments[1];
 
-    auto mappedProps = _propsContainer->getMappedProperties();
-    auto propMapIt = mappedProps.find(JsiPropId::get(propName));
-    if (propMapIt != mappedProps.end()) {
-      for (auto &prop : propMapIt->second) {
-        prop->updateValue(runtime, propValue);
-      }
-    }
+    _propsContainer->updateValue(runtime, JsiPropId::get(propName), propValue);
 
     return jsi::Value::undefined();
   }
@@ -157,11 +200,20 @@ public:
    JS Function for getting child nodes for this node
    */
   JSI_HOST_FUNCTION(children) {
-    auto array = jsi::Array(runtime, _children.size());
+    // Children are linked by the render thread, so a snapshot is taken under
+    // the lock and converted to host objects after releasing it
+    std::vector<std::shared_ptr<JsiDomNode>> children;
+    {
+      std::lock_guard<std::mutex> lock(_childrenMutex);
+      children.reserve(_childCount);
+      for (auto &child : getChildren()) {
+        children.push_back(child);
+      }
+    }
 
-    size_t index = 0;
-    for (auto child : _children) {
-      array.setValueAtIndex(runtime, index++, child->asHostObject(runtime));
+    auto array = jsi::Array(runtime, children.size());
+    for (size_t i = 0; i < children.size(); ++i) {
+      array.setValueAtIndex(runtime, i, children[i]->asHostObject(runtime));
     }
     return array;
   }
@@ -198,6 +250,14 @@ public:
    */
   NodePropsContainer *getPropsContainer() { return _propsContainer.get(); }
 
+  /**
+   Returns all child JsiDomNodes for this node. Only called from the render
+   thread, which is the only thread changing the children.
+   */
+  JsiDomNodeChildren getChildren() {
+    return JsiDomNodeChildren(&_firstChild, _childCount);
+  }
+
   /**
    Callback that will be called when the node is disposed - typically registered
    from the dependency manager so that nodes can be removed and unsubscribed
@@ -207,44 +267,64 @@ public:
     _disposeCallback = disposeCallback;
   }
 
-  /**
-   Invalidates and marks then context as changed. The default behaviour is an
-   empty implementation
-   */
-  virtual void invalidateContext() = 0;
-
   /*
    Returns the class of node so that we can do loops faster without
    having to check using runtime type information
    */
   NodeClass getNodeClass() { return _nodeClass; }
 
+  /**
+   Returns a number that changes every time changes in this node or any of its
+   descendants are committed
+   */
+  size_t getSubtreeVersion() { return _subtreeVersion; }
+
+  /**
+   Returns true if this node or any of its descendants changed in the current
+   commit
+   */
+  bool isSubtreeCommitted() { return _needsReset; }
+
+  /**
+   Returns true if the props or children of this node, or the declarations it
+   uses, changed in the current commit
+   */
+  bool hasCommittedChanges() { return _hasCommittedChanges; }
+
+  /**
+   Returns the cached state invalidated by committed changes that has not been
+   rebuilt yet
+   */
+  NodeInvalidationMask getInvalidations() { return _invalidations; }
+
   /**
    Updates any pending property changes in all nodes and child nodes. This
    function will swap any pending property changes in this and children with any
    waiting values that has been set by the javascript thread. Props will also be
    marked as changed so that we can calculate wether updates are required or
-   not.
+   not. Subtrees without changes are skipped. Returns the number of nodes
+   committed.
    */
-  void commitPendingChanges() {
-    // Update properties container
-    if (_propsContainer != nullptr) {
-      _propsContainer->updatePendingValues();
-    }
-
-    // Run all pending node operations
-    {
-      std::lock_guard<std::mutex> lock(_childrenLock);
-      for (auto &op : _queuedNodeOps) {
-        op();
-      }
-
-      _queuedNodeOps.clear();
+  size_t commitPendingChanges() {
+    // Clean subtrees have nothing to commit. The flag is cleared before
+    // committing so that changes made while we commit are seen next frame.
+    // Host objects held by props, like paths, are changed in place without
+    // marking anything dirty, so subtrees holding them are also visited when
+    // any such object changed.
+    auto isDirty = _isSubtreeDirty.exchange(false);
+    auto mutationCount = JsiSkMutableHostObject::getMutationCount();
+    if (!isDirty &&
+        (!_holdsMutableValues || _checkedMutationCount == mutationCount)) {
+      return 0;
     }
-
-    // Update children
-    for (auto &child : _children) {
-      child->commitPendingChanges();
+    _checkedMutationCount = mutationCount;
+    try {
+      return commitSubtree(isDirty);
+    } catch (...) {
+      // Children may not have been visited. Marks stopping at this node rely
+      // on it being visited by the next commit.
+      _isSubtreeDirty = true;
+      throw;
     }
   }
 
@@ -254,18 +334,28 @@ public:
    child nodes
    */
   virtual void resetPendingChanges() {
+    // Only nodes visited by the commit pass have changes to resolve
+    if (!_needsReset) {
+      return;
+    }
+    _needsReset = false;
+    _hasCommittedChanges = false;
+
     // Mark self as resolved
     if (_propsContainer != nullptr) {
       _propsContainer->markAsResolved();
     }
 
-    // Now let's invalidate if needed
+    // Now let's invalidate if needed. Operations queued since the commit are
+    // dropped here, since only the render thread may consume the queue. Nodes
+    // invalidated from the JS thread release their operations with the node.
     if (_isDisposing && !_isDisposed) {
       invalidate();
+      _queuedNodeOps.clear();
     }
 
     // Resolve children
-    for (auto &child : _children) {
+    for (auto &child : getChildren()) {
       child->resetPendingChanges();
     }
   }
@@ -290,17 +380,100 @@ public:
     _isDisposing = true;
     if (immediate) {
       invalidate();
+    } else {
+      // Invalidated in the next reset pass
+      markSubtreeDirty();
+    }
+  }
+
+  /**
+   Marks this node and its ancestors as having changes to commit in the next
+   render cycle. Can be called from any thread.
+   */
+  void markSubtreeDirty() {
+    _isSubtreeDirty = true;
+    // We stop at the first ancestor that is already dirty. Its ancestors were
+    // marked when it was, and the commit pass clears the flags top down before
+    // visiting the children, so a dirty ancestor is reached by the pass that
+    // clears it. Each parent is locked before it is touched, since the render
+    // thread may release it.
+    for (auto parent = getParent();
+         parent != nullptr && !parent->_isSubtreeDirty.exchange(true);
+         parent = parent->getParent()) {
     }
   }
 
+  /**
+   Adds a child node to the array of children for this node
+   */
+  virtual void addChild(std::shared_ptr<JsiDomNode> child) {
+#if SKIA_DOM_DEBUG
+    printDebugInfo("JS:addChild(childId: " + std::to_string(child->_nodeId) +
+                   ")");
+#endif
+    enqueAsynOperation({NodeOpType::AddChild, std::move(child), nullptr});
+  }
+
 protected:
   /**
-   Adds an operation that will be executed when the render cycle is finished.
+   Adds an operation that will be executed in the next commit. Operations are
+   only added from the JS thread.
+   */
+  void enqueAsynOperation(NodeOp &&op) {
+    _queuedNodeOps.push(std::move(op));
+    markSubtreeDirty();
+  }
+
+  /**
+   Override to declare what a change to the prop with the given name
+   invalidates. Called once per node type when its props are laid out.
+   */
+  virtual NodeInvalidationMask getPropInvalidations(PropId name) {
+    return InvalidatesNone;
+  }
+
+  /**
+   Override to declare what changes to the declarations among the children of
+   the node invalidate. Declarations make the paint of the node by default.
+   */
+  virtual NodeInvalidationMask getDeclarationInvalidations() {
+    return InvalidatesPaint;
+  }
+
+  /**
+   Invalidates cached state of the node in the next commit. Can be called from
+   any thread.
+   */
+  void addInvalidations(NodeInvalidationMask invalidations) {
+    _pendingInvalidations.fetch_or(invalidations);
+    markSubtreeDirty();
+  }
+
+  /**
+   Returns true if any of the given cached state is invalidated, and marks it
+   as rebuilt. Called from the render pass by the code rebuilding the state.
    */
-  void enqueAsynOperation(std::function<void()> &&fp) {
-    std::lock_guard<std::mutex> lock(_childrenLock);
-    _queuedNodeOps.push_back(std::move(fp));
+  bool consumeInvalidations(NodeInvalidationMask invalidations) {
+    if ((_invalidations & invalidations) == InvalidatesNone) {
+      return false;
+    }
+    _invalidations &= ~invalidations;
+    return true;
   }
+
+  /**
+   Called by the commit pass after the changes of the node and its children
+   have been committed. Override to update state derived from the subtree,
+   which stays valid while the subtree is clean.
+   */
+  virtual void onSubtreeCommitted() {}
+
+  /**
+   Called when the node is invalidated, from the render thread or while the
+   view is not rendering. Override to release resources held by the node.
+   */
+  virtual void onInvalidated() {}
+
   /**
    Override to define properties in node implementations
    */
@@ -331,9 +504,7 @@ protected:
 
     // Update properties container
     _propsContainer->setProps(runtime, maybeProps);
-
-    // Invalidate context
-    invalidateContext();
+    markSubtreeDirty();
   }
 
   /**
@@ -347,36 +518,6 @@ protected:
     ensurePropertyContainer();
   }
 
-  /**
-   Returns all child JsiDomNodes for this node.
-   */
-  const std::vector<std::shared_ptr<JsiDomNode>> &getChildren() {
-    std::lock_guard<std::mutex> lock(_childrenLock);
-    return _children;
-  }
-
-  /**
-   Override to be notified when a node property has changed
-   */
-  virtual void onPropertyChanged(BaseNodeProp *prop) {}
-
-  /**
-   Adds a child node to the array of children for this node
-   */
-  virtual void addChild(std::shared_ptr<JsiDomNode> child) {
-#if SKIA_DOM_DEBUG
-    printDebugInfo("JS:addChild(childId: " + std::to_string(child->_nodeId) +
-                   ")");
-#endif
-    enqueAsynOperation([child, weakSelf = weak_from_this()]() {
-      auto self = weakSelf.lock();
-      if (self) {
-        self->_children.push_back(child);
-        child->setParent(self.get());
-      }
-    });
-  }
-
   /**
    Inserts a child node before a given child node in the children array for this
    node
@@ -388,50 +529,27 @@ protected:
         "JS:insertChildBefore(childId: " + std::to_string(child->_nodeId) +
         ", beforeId: " + std::to_string(before->_nodeId) + ")");
 #endif
-    enqueAsynOperation([child, before, weakSelf = weak_from_this()]() {
-      auto self = weakSelf.lock();
-      if (self) {
-        auto position =
-            std::find(self->_children.begin(), self->_children.end(), before);
-        self->_children.insert(position, child);
-        child->setParent(self.get());
-      }
-    });
+    enqueAsynOperation(
+        {NodeOpType::InsertChildBefore, std::move(child), std::move(before)});
   }
 
   /**
    Removes a child. Removing a child will remove the child from the array of
-   children and call dispose on the child node.
+   children and call dispose on the child node. Queued like any other change
+   of the children, also while the node is disposing: the children of a
+   disposing node are disposed when it is invalidated.
    */
   virtual void removeChild(std::shared_ptr<JsiDomNode> child) {
 #if SKIA_DOM_DEBUG
     printDebugInfo("JS:removeChild(childId: " + std::to_string(child->_nodeId) +
                    ")");
 #endif
-    auto removeChild = [child,
-                        weakSelf = weak_from_this()](bool immediate = false) {
-      auto self = weakSelf.lock();
-      if (self) {
-        // Delete child itself
-        self->_children.erase(
-            std::remove_if(self->_children.begin(), self->_children.end(),
-                           [child](const auto &node) { return node == child; }),
-            self->_children.end());
-
-        child->dispose(immediate);
-      }
-    };
-
-    if (_isDisposing) {
-      removeChild(false);
-    } else {
-      enqueAsynOperation(removeChild);
-    }
+    enqueAsynOperation({NodeOpType::RemoveChild, std::move(child), nullptr});
   }
 
 #if SKIA_DOM_DEBUG
   std::string getLevelIndentation(size_t indentation = 0) {
-    JsiDomNode *curParent = _parent;
+    auto curParent = getParent();
     while (curParent != nullptr) {
       indentation++;
       curParent = curParent->getParent();
@@ -449,12 +567,19 @@ protected:
   /**
    Sets the parent node
   */
-  void setParent(JsiDomNode *parent) { _parent = parent; }
+  void setParent(const std::weak_ptr<JsiDomNode> &parent) {
+    std::lock_guard<std::mutex> lock(_parentMutex);
+    _parent = parent;
+  }
 
   /**
-   Returns the parent node if set.
+   Returns the parent node if set and still alive. Can be called from any
+   thread.
   */
-  JsiDomNode *getParent() { return _parent; }
+  std::shared_ptr<JsiDomNode> getParent() {
+    std::lock_guard<std::mutex> lock(_parentMutex);
+    return _parent.lock();
+  }
 
   /**
   Loops through all declaration nodes and gives each one of them the
@@ -469,6 +594,166 @@ protected:
   }
 
 private:
+  /**
+   Commits the props, operations and children of a node visited by the commit
+   pass. Returns the number of nodes committed.
+   */
+  size_t commitSubtree(bool isDirty) {
+    size_t committedNodes = 0;
+
+    // Update properties container
+    if (_propsContainer != nullptr &&
+        (isDirty || _propsContainer->hasMutableValues())) {
+      _propsContainer->updatePendingValues();
+      _hasCommittedChanges = _propsContainer->isChanged();
+      _invalidations |= _propsContainer->getMutationInvalidations();
+    }
+
+    if (isDirty) {
+      _invalidations |= _pendingInvalidations.exchange(InvalidatesNone);
+
+      // Run all pending node operations
+      if (_queuedNodeOps.drain([this](NodeOp &op) { applyOperation(op); }) >
+          0) {
+        _hasCommittedChanges = true;
+      }
+    }
+
+    // Update children
+    auto holdsMutableValues =
+        _propsContainer != nullptr && _propsContainer->hasMutableValues();
+    for (auto &child : getChildren()) {
+      committedNodes += child->commitPendingChanges();
+      holdsMutableValues = holdsMutableValues || child->_holdsMutableValues;
+      // Declarations are drawn as part of the node using them
+      if (child->getNodeClass() == NodeClass::DeclarationNode &&
+          child->hasCommittedChanges()) {
+        _hasCommittedChanges = true;
+        _invalidations |= getDeclarationInvalidations();
+      }
+    }
+    _holdsMutableValues = holdsMutableValues;
+
+    // Visited for host objects changed elsewhere
+    if (!isDirty && !_hasCommittedChanges && committedNodes == 0) {
+      return 0;
+    }
+    _needsReset = true;
+    _subtreeVersion++;
+    onSubtreeCommitted();
+    return committedNodes + 1;
+  }
+
+  /**
+   Applies an operation queued from the JS thread
+   */
+  void applyOperation(NodeOp &op) {
+    switch (op.type) {
+    case NodeOpType::AddChild:
+      linkChild(op.child, nullptr);
+      op.child->setParent(weak_from_this());
+      break;
+    case NodeOpType::InsertChildBefore:
+      linkChild(op.child, op.before.get());
+      op.child->setParent(weak_from_this());
+      break;
+    case NodeOpType::RemoveChild:
+      removeChildNow(op.child, false);
+      break;
+    }
+    if (op.child->getNodeClass() == NodeClass::DeclarationNode) {
+      _invalidations |= getDeclarationInvalidations();
+    }
+  }
+
+  /**
+   Removes the child from the children and disposes it
+   */
+  void removeChildNow(const std::shared_ptr<JsiDomNode> &child,
+                      bool immediate) {
+    // Delete child itself
+    if (child->_listParent == this) {
+      unlinkChild(child.get());
+    }
+
+    child->dispose(immediate);
+  }
+
+  /**
+   Links the child into the children before the given child, or last if the
+   given child is null or not a child of this node. A child that is already
+   linked is moved.
+   */
+  void linkChild(const std::shared_ptr<JsiDomNode> &child, JsiDomNode *before) {
+    if (child->_listParent != nullptr) {
+      child->_listParent->unlinkChild(child.get());
+    }
+    std::lock_guard<std::mutex> lock(_childrenMutex);
+    if (before != nullptr && before->_listParent != this) {
+      before = nullptr;
+    }
+    if (before == nullptr) {
+      child->_prevSibling = _lastChild;
+      auto &link =
+          _lastChild != nullptr ? _lastChild->_nextSibling : _firstChild;
+      link = child;
+      _lastChild = child.get();
+    } else {
+      child->_prevSibling = before->_prevSibling;
+      auto &link = before->_prevSibling != nullptr
+                       ? before->_prevSibling->_nextSibling
+                       : _firstChild;
+      child->_nextSibling = std::move(link);
+      link = child;
+      before->_prevSibling = child.get();
+    }
+    child->_listParent = this;
+    _childCount++;
+  }
+
+  /**
+   Unlinks the child from the children
+   */
+  void unlinkChild(JsiDomNode *child) {
+    // Keeps the child alive until it is unlinked and the lock is released
+    std::shared_ptr<JsiDomNode> self;
+    std::lock_guard<std::mutex> lock(_childrenMutex);
+    auto &link = child->_prevSibling != nullptr
+                     ? child->_prevSibling->_nextSibling
+                     : _firstChild;
+    self = std::move(link);
+    if (child->_nextSibling != nullptr) {
+      child->_nextSibling->_prevSibling = child->_prevSibling;
+    } else {
+      _lastChild = child->_prevSibling;
+    }
+    link = std::move(child->_nextSibling);
+    child->_prevSibling = nullptr;
+    child->_listParent = nullptr;
+    _childCount--;
+  }
+
+  /**
+   Unlinks all children. The links are released one at a time, releasing the
+   first child would otherwise release its siblings recursively.
+   */
+  void unlinkChildren() {
+    std::shared_ptr<JsiDomNode> child;
+    {
+      std::lock_guard<std::mutex> lock(_childrenMutex);
+      child = std::move(_firstChild);
+      _lastChild = nullptr;
+      _childCount = 0;
+    }
+    // The detached list is only reachable from here
+    while (child != nullptr) {
+      auto next = std::move(child->_nextSibling);
+      child->_prevSibling = nullptr;
+      child->_listParent = nullptr;
+      child = std::move(next);
+    }
+  }
+
   /**
    Invalidates the node - meaning removing and clearing children and properties
    **/
@@ -482,10 +767,7 @@ private:
       _isDisposed = true;
 
       // Clear parent
-      this->setParent(nullptr);
-
-      // Clear any async operations
-      _queuedNodeOps.clear();
+      this->setParent({});
 
       // Callback signaling that we're done
       if (_disposeCallback != nullptr) {
@@ -498,16 +780,15 @@ private:
         _propsContainer->dispose();
       }
 
+      onInvalidated();
+
       // Remove children
       std::vector<std::shared_ptr<JsiDomNode>> tmp;
-      {
-        std::lock_guard<std::mutex> lock(_childrenLock);
-        tmp.reserve(_children.size());
-        for (auto &child : _children) {
-          tmp.push_back(child);
-        }
-        _children.clear();
+      tmp.reserve(_childCount);
+      for (auto &child : getChildren()) {
+        tmp.push_back(child);
       }
+      unlinkChildren();
       for (auto &child : tmp) {
         child->dispose(true);
       }
@@ -523,12 +804,21 @@ private:
           getType(), [weakSelf = weak_from_this()](BaseNodeProp *p) {
             auto self = weakSelf.lock();
             if (self) {
-              self->onPropertyChanged(p);
+              // Change notifications are only sent from NodeProp instances
+              self->addInvalidations(self->_propsContainer->getInvalidations(
+                  static_cast<NodeProp *>(p)));
             }
           });
 
       // Ask sub classes to define their properties
       defineProperties(_propsContainer.get());
+      _propsContainer->initializeSlots(
+          [this](PropId name) { return getPropInvalidations(name); });
+
+      // Before the node is first rendered, which builds all of the state it
+      // caches
+      _invalidations = _propsContainer->getAllInvalidations() |
+                       getDeclarationInvalidations();
     }
   }
 
@@ -539,19 +829,68 @@ private:
 
   std::function<void()> _disposeCallback;
 
-  std::vector<std::shared_ptr<JsiDomNode>> _children;
-  std::mutex _childrenLock;
+  // Children, linked through their sibling pointers. Only the render thread
+  // changes them, under the lock since the JS thread reads them.
+  std::mutex _childrenMutex;
+  std::shared_ptr<JsiDomNode> _firstChild;
+  JsiDomNode *_lastChild = nullptr;
+  size_t _childCount = 0;
+
+  // Links in the children of the node this node is a child of
+  std::shared_ptr<JsiDomNode> _nextSibling;
+  JsiDomNode *_prevSibling = nullptr;
+  JsiDomNode *_listParent = nullptr;
 
   std::atomic<bool> _isDisposing = {false};
   bool _isDisposed = false;
 
   size_t _nodeId;
 
-  std::vector<std::function<void()>> _queuedNodeOps;
+  NodeOpQueue _queuedNodeOps;
+
+  // Read from the JS thread when marking ancestors as dirty, while the render
+  // thread links and releases nodes
+  std::weak_ptr<JsiDomNode> _parent;
+  std::mutex _parentMutex;
+
+  // Set when this node or any of its descendants has changes to commit
+  std::atomic<bool> _isSubtreeDirty = {true};
+
+  // Set when this node or any of its descendants has props holding host
+  // objects that are changed in place, and the mutation count they were last
+  // checked at
+  bool _holdsMutableValues = false;
+  size_t _checkedMutationCount = 0;
+
+  // Set by the commit pass for nodes that should be visited by the reset pass
+  bool _needsReset = false;
 
-  JsiDomNode *_parent = nullptr;
+  // Incremented by the commit pass each time this subtree is visited
+  size_t _subtreeVersion = 0;
+
+  // Set by the commit pass when this node has changes, until the reset pass
+  bool _hasCommittedChanges = false;
+
+  // Cached state invalidated from the JS thread, moved to _invalidations by
+  // the commit pass
+  std::atomic<NodeInvalidationMask> _pendingInvalidations = {InvalidatesNone};
+
+  // Cached state to rebuild, all of the state the node caches until it is
+  // first rendered
+  NodeInvalidationMask _invalidations = InvalidatesAll;
 
   NodeClass _nodeClass;
+
+  friend class JsiDomNodeChildren::Iterator;
 };
 
+inline JsiDomNodeChildren::Iterator &
+JsiDomNodeChildren::Iterator::operator++() {
+  _slot = &(*_slot)->_nextSibling;
+  if (*_slot == nullptr) {
+    _slot = nullptr;
+  }
+  return *this;
+}
+
 } // namespace RNSkia
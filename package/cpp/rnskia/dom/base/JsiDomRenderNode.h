@@ -17,6 +17,16 @@
 #include <string>
 #include <vector>
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkBBHFactory.h"
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+#include "SkSurface.h"
+
+#pragma clang diagnostic pop
+
 namespace RNSkia {
 
 class JsiDomRenderNode : public JsiDomNode {
@@ -26,18 +36,311 @@ public:
       : JsiDomNode(context, type, NodeClass::RenderNode) {}
 
   void render(DrawingContext *context) {
+    updateLayer();
+    if (context->isMeasuring()) {
+      measure(context);
+      return;
+    }
+    if (context->isCullingToDamage() && _damageState.isMeasured &&
+        !SkRect::Intersects(_damageState.bounds, context->getDamage())) {
+#if SKIA_DOM_DEBUG
+      printDebugInfo("Culled outside of damage");
+#endif
+      context->addDamageCulledNode();
+      return;
+    }
+    renderCached(context);
+  }
+
+  /**
+   Returns true if the node can draw something different without any committed
+   changes, for example when drawing from a callback. Such nodes are redrawn
+   every frame.
+   */
+  virtual bool hasVolatileContent() { return false; }
+
+  /**
+   Returns true if the node draws from what is below it, as backdrop filters
+   do. Such nodes change whenever anything below them changes.
+   */
+  virtual bool readsBackdrop() { return false; }
+
+  /**
+   Returns true if this node and its descendants can be recorded once and
+   replayed while unchanged. Updated by the commit pass.
+   */
+  bool isRecordable() { return _isRecordable; }
+
+  /**
+   Returns true if this node or any of its descendants reads the backdrop.
+   Updated by the commit pass.
+   */
+  bool subtreeReadsBackdrop() { return _subtreeReadsBackdrop; }
+
+  /**
+   Override reset (last thing that happens in the render cycle) to also reset
+   the changed flag on the local drawing context if necessary.
+   */
+  void resetPendingChanges() override { JsiDomNode::resetPendingChanges(); }
+
+  /**
+   Overridden to release the cached paint, pictures and images. Called on the
+   render thread, which may still be drawing the node while it is disposed
+   from JS.
+   */
+  void onInvalidated() override {
+    _paintCache.clear();
+    _pictureCache.clear();
+    _rasterCache.clear();
+    _damageState = DamageState();
+  }
+
+protected:
+  /**
+   Override to implement rendering where the current state of the drawing
+   context is correctly set.
+   */
+  virtual void renderNode(DrawingContext *context) = 0;
+
+  /**
+   Returns true if the layer the node is drawn through can change pixels
+   outside of what its children draw, as image filters, color filters and
+   blend modes other than SrcOver can.
+   */
+  virtual bool hasUnboundedLayer(DrawingContext *context) {
+    return _layerCache.isUnbounded;
+  }
+
+  static bool isUnboundedLayerPaint(const SkPaint &paint) {
+    return paint.getImageFilter() != nullptr ||
+           paint.getColorFilter() != nullptr ||
+           !paint.isSrcOver();
+  }
+
+  /**
+   Optional property for rendering the node through a cached raster image,
+   defined by nodes that support it.
+   */
+  NodeProp *_rasterizeProp = nullptr;
+
+  /**
+   Define common properties for all render nodes
+   */
+  void defineProperties(NodePropsContainer *container) override {
+    JsiDomNode::defineProperties(container);
+
+    _paintProps = container->defineProperty<PaintProps>();
+
+    _matrixProp = container->defineProperty<MatrixProp>(PropNameMatrix);
+    _transformProp =
+        container->defineProperty<TransformProp>(PropNameTransform);
+    _originProp = container->defineProperty<PointProp>(PropNameOrigin);
+    _clipProp = container->defineProperty<ClipProp>(PropNameClip);
+    _invertClip = container->defineProperty<NodeProp>(PropNameInvertClip);
+    _layerProp = container->defineProperty<LayerProp>(PropNameLayer);
+  }
+
+  /**
+   Updates the recordability of the subtree from the cached state of the
+   children, which is up to date since children are committed first
+   */
+  void onSubtreeCommitted() override {
+    // Rasterized nodes are kept out of retained pictures, since they must be
+    // rasterized with the matrix of the canvas they are finally drawn to
+    _isRecordable = !hasVolatileContent() && !isRasterized();
+    _hasVolatileSubtree = hasVolatileContent();
+    _subtreeReadsBackdrop = readsBackdrop();
+    _hasRenderChildren = false;
+    for (auto &child : getChildren()) {
+      if (child->getNodeClass() == NodeClass::RenderNode) {
+        auto renderChild = static_cast<JsiDomRenderNode *>(child.get());
+        _hasRenderChildren = true;
+        _isRecordable = _isRecordable && renderChild->_isRecordable;
+        _hasVolatileSubtree =
+            _hasVolatileSubtree || renderChild->_hasVolatileSubtree;
+        _subtreeReadsBackdrop =
+            _subtreeReadsBackdrop || renderChild->_subtreeReadsBackdrop;
+      }
+    }
+  }
+
+  /**
+   Returns true if the prop is one of the props common to all render nodes
+   */
+  static bool isRenderNodeProp(PropId name) {
+    static const PropIdSet renderNodeProps = {
+        PropNameColor,      PropNameStrokeWidth, PropNameBlendMode,
+        PropNameStrokeCap,  PropNameStrokeJoin,  PropNameStrokeMiter,
+        PropNameStyle,      PropNameAntiAlias,   PropNameOpacity,
+        PropNamePaint,      PropNameMatrix,      PropNameTransform,
+        PropNameOrigin,     PropNameClip,        PropNameInvertClip,
+        PropNameLayer,      PropNameRasterize};
+    return renderNodeProps.contains(name);
+  }
+
+  /**
+   Declares what the props common to all render nodes invalidate. The clip is
+   read from its props each time the node is drawn.
+   */
+  NodeInvalidationMask getPropInvalidations(PropId name) override {
+    static const PropIdSet paintProps = {
+        PropNameColor,     PropNameStrokeWidth, PropNameBlendMode,
+        PropNameStrokeCap, PropNameStrokeJoin,  PropNameStrokeMiter,
+        PropNameStyle,     PropNameAntiAlias,   PropNameOpacity,
+        PropNamePaint};
+    static const PropIdSet matrixProps = {PropNameMatrix, PropNameTransform,
+                                          PropNameOrigin};
+    static const PropIdSet layerProps = {PropNameLayer, PropNameRasterize};
+
+    if (paintProps.contains(name)) {
+      return InvalidatesPaint;
+    } else if (matrixProps.contains(name)) {
+      return InvalidatesMatrix;
+    } else if (layerProps.contains(name)) {
+      return InvalidatesLayer;
+    }
+    return InvalidatesNone;
+  }
+
+private:
+  /**
+   Renders the node from the cached picture or image if possible
+   */
+  void renderCached(DrawingContext *context) {
+    if (isRasterized()) {
+      renderRasterized(context);
+      return;
+    }
+
+    auto picture = getRetainedPicture(context);
+    if (picture != nullptr) {
+#if SKIA_DOM_DEBUG_VERBOSE
+      printDebugInfo("canvas->drawPicture(retained)");
+#endif
+      context->getCanvas()->drawPicture(picture);
+      return;
+    }
+    renderUnretained(context);
+  }
+
+  bool isRasterized() {
+    return _rasterizeProp != nullptr && _rasterizeProp->isSet() &&
+           _rasterizeProp->value().getAsBool();
+  }
+
+  /**
+   Updates what is derived from the layer props when they changed. The image
+   of a node that is no longer rasterized is dropped.
+   */
+  void updateLayer() {
+    if (!consumeInvalidations(InvalidatesLayer)) {
+      return;
+    }
+    _layerCache.isUnbounded =
+        _layerProp->isSet() && !_layerProp->isBool() &&
+        isUnboundedLayerPaint(*_layerProp->getDerivedValue());
+    if (!isRasterized()) {
+      _rasterCache.clear();
+      _rasterCache.version = 0;
+    }
+  }
+
+  /**
+   Composes the matrix applied to the canvas from the matrix or transform
+   props around the origin
+   */
+  void updateMatrix() {
+    _matrixCache.isSet = _matrixProp->isSet() || _transformProp->isSet();
+    if (!_matrixCache.isSet) {
+      return;
+    }
+    auto matrix = _matrixProp->isSet() ? _matrixProp->getDerivedValue()
+                                       : _transformProp->getDerivedValue();
+    if (_originProp->isSet()) {
+      auto origin = _originProp->getDerivedValue();
+      _matrixCache.matrix.setTranslate(origin->x(), origin->y());
+      _matrixCache.matrix.preConcat(*matrix);
+      _matrixCache.matrix.preTranslate(-origin->x(), -origin->y());
+    } else {
+      _matrixCache.matrix = *matrix;
+    }
+  }
+
+  /**
+   Measures the device space bounds of the node and its subtree on the
+   measure canvas. Unchanged subtrees report the bounds cached when they were
+   last measured without being visited. Changed nodes damage the region they
+   were drawn in and the region they are drawn in now.
+   */
+  void measure(DrawingContext *context) {
+    auto isMeasuringAll = context->isMeasuringAll();
+    if (!isMeasuringAll && _damageState.isMeasured && !isSubtreeCommitted() &&
+        !_hasVolatileSubtree) {
+      context->addBounds(_damageState.bounds);
+      return;
+    }
+
+    // A layer that is not bounded by its children changes wherever they do
+    auto isDamageRoot =
+        !isMeasuringAll &&
+        (!_damageState.isMeasured || hasCommittedChanges() ||
+         hasVolatileContent() ||
+         (isSubtreeCommitted() && hasUnboundedLayer(context)));
+    if (isDamageRoot) {
+      if (_damageState.isMeasured) {
+        context->addDamage(_damageState.bounds);
+      }
+      context->setMeasuringAll(true);
+    }
+
+    auto outer = context->beginBounds();
+    try {
+      if (hasUnboundedLayer(context)) {
+        context->addClipBounds();
+      }
+      renderUnretained(context);
+    } catch (...) {
+      context->endBounds(outer);
+      context->setMeasuringAll(isMeasuringAll);
+      throw;
+    }
+    _damageState.bounds = context->endBounds(outer);
+    _damageState.isMeasured = true;
+
+    if (isDamageRoot) {
+      context->addDamage(_damageState.bounds);
+      context->setMeasuringAll(isMeasuringAll);
+    }
+  }
+
+  /**
+   Renders the node and its children
+   */
+  void renderUnretained(DrawingContext *context) {
 #if SKIA_DOM_DEBUG
     printDebugInfo("Begin Render");
 #endif
 
-    auto parentPaint = context->getPaint();
-    auto cache =
-        _paintCache.parent == parentPaint ? _paintCache.child : nullptr;
+    // The compiled paint is only patched when the paint props or
+    // declarations of the node, or the paint it inherits, changed
+    auto parentPaintVersion = context->getPaintVersion();
+    if (consumeInvalidations(InvalidatesPaint) ||
+        _paintCache.parentVersion != parentPaintVersion) {
+      _paintCache.parentVersion = parentPaintVersion;
+      _paintCache.isSet =
+          context->compilePaint(_paintProps, this, _paintCache.paint);
+      _paintCache.version = DrawingContext::nextPaintVersion();
+    }
 
-    auto shouldRestore =
-        context->saveAndConcat(_paintProps, getChildren(), cache);
+    auto shouldRestore = _paintCache.isSet;
+    if (shouldRestore) {
+      context->pushPaint(_paintCache.paint.get(), _paintCache.version);
+    }
 
-    auto shouldTransform = _matrixProp->isSet() || _transformProp->isSet();
+    if (consumeInvalidations(InvalidatesMatrix)) {
+      updateMatrix();
+    }
+    auto shouldTransform = _matrixCache.isSet;
     auto shouldSave =
         shouldTransform || _clipProp->isSet() || _layerProp->isSet();
 
@@ -65,42 +368,28 @@ public:
         context->getCanvas()->save();
       }
 
-      if (_originProp->isSet()) {
-#if SKIA_DOM_DEBUG_VERBOSE
-        printDebugInfo("canvas->translate(origin)");
-#endif
-        // Handle origin
-        context->getCanvas()->translate(_originProp->getDerivedValue()->x(),
-                                        _originProp->getDerivedValue()->y());
-      }
-
       if (shouldTransform) {
 #if SKIA_DOM_DEBUG_VERBOSE
-        printDebugInfo(
-            "canvas->concat(" +
-            std::string(_matrixProp->isSet() ? "matrix" : "transform") +
-            std::string(")"));
+        printDebugInfo("canvas->concat(matrix)");
 #endif
-        auto matrix = _matrixProp->isSet() ? _matrixProp->getDerivedValue()
-                                           : _transformProp->getDerivedValue();
-
-        // Concat canvas' matrix with our matrix
-        context->getCanvas()->concat(*matrix);
+        // Concat canvas' matrix with our matrix, composed around the origin
+        context->getCanvas()->concat(_matrixCache.matrix);
       }
 
-      // Clipping
+      // Clipping, around the origin as well
       if (_clipProp->isSet()) {
+        auto hasOrigin = _originProp->isSet();
+        auto canvas = context->getCanvas();
+        if (hasOrigin) {
+          canvas->translate(_originProp->getDerivedValue()->x(),
+                            _originProp->getDerivedValue()->y());
+        }
         auto invert = _invertClip->isSet() && _invertClip->value().getAsBool();
-        clip(context, context->getCanvas(), invert);
-      }
-
-      if (_originProp->isSet()) {
-#if SKIA_DOM_DEBUG_VERBOSE
-        printDebugInfo("canvas->translate(-origin)");
-#endif
-        // Handle origin
-        context->getCanvas()->translate(-_originProp->getDerivedValue()->x(),
-                                        -_originProp->getDerivedValue()->y());
+        clip(context, canvas, invert);
+        if (hasOrigin) {
+          canvas->translate(-_originProp->getDerivedValue()->x(),
+                            -_originProp->getDerivedValue()->y());
+        }
       }
     }
 
@@ -116,8 +405,6 @@ public:
     }
 
     if (shouldRestore) {
-      _paintCache.parent = parentPaint;
-      _paintCache.child = context->getPaint();
       context->restore();
     }
 
@@ -127,95 +414,160 @@ public:
   }
 
   /**
-   Override reset (last thing that happens in the render cycle) to also reset
-   the changed flag on the local drawing context if necessary.
-   */
-  void resetPendingChanges() override { JsiDomNode::resetPendingChanges(); }
-
-  /**
-   Overridden dispose to release resources
-   */
-  void dispose(bool immediate) override {
-    JsiDomNode::dispose(immediate);
-    _paintCache.clear();
-  }
-
-protected:
-  /**
-   Invalidates and marks then context as changed.
+   Returns the picture to replay instead of rendering this node, or null.
+   Subtrees without committed changes for a number of frames are recorded
+   into a picture that is replayed until a change is committed in the subtree
+   or the paint inherited from the parent changes.
    */
-  void invalidateContext() override {
-    enqueAsynOperation([weakSelf = weak_from_this()]() {
-      auto self = weakSelf.lock();
-      if (self) {
-        std::static_pointer_cast<JsiDomRenderNode>(self)->_paintCache.parent =
-            nullptr;
-        std::static_pointer_cast<JsiDomRenderNode>(self)->_paintCache.child =
-            nullptr;
+  sk_sp<SkPicture> getRetainedPicture(DrawingContext *context) {
+    auto version = getSubtreeVersion();
+    auto parentPaintVersion = context->getPaintVersion();
+    if (_pictureCache.version != version ||
+        _pictureCache.parentPaintVersion != parentPaintVersion) {
+      _pictureCache.clear();
+      _pictureCache.version = version;
+      _pictureCache.parentPaintVersion = parentPaintVersion;
+      return nullptr;
+    }
+    if (_pictureCache.picture == nullptr) {
+      // Only nodes drawing other render nodes gain from being recorded, and
+      // only the topmost unchanged subtree is recorded. Its descendants are
+      // not drawn again while its picture is replayed.
+      if (++_pictureCache.unchangedFrames < RetainAfterUnchangedFrames ||
+          !_hasRenderChildren || !_isRecordable || context->isRecording()) {
+        return nullptr;
+      }
+#if SKIA_DOM_DEBUG
+      printDebugInfo("Recording retained picture");
+#endif
+      // The picture is replayed in later frames with other damage
+      SkPictureRecorder recorder;
+      auto canvas = context->getCanvas();
+      auto isCullingToDamage = context->isCullingToDamage();
+      context->setCanvas(recorder.beginRecording(SkRect::MakeLargest()));
+      context->setCullingToDamage(false);
+      context->setRecording(true);
+      try {
+        renderUnretained(context);
+      } catch (...) {
+        context->setCanvas(canvas);
+        context->setCullingToDamage(isCullingToDamage);
+        context->setRecording(false);
+        throw;
       }
-    });
+      context->setCanvas(canvas);
+      context->setCullingToDamage(isCullingToDamage);
+      context->setRecording(false);
+      _pictureCache.picture = recorder.finishRecordingAsPicture();
+    }
+    return _pictureCache.picture;
   }
 
   /**
-   Override to implement rendering where the current state of the drawing
-   context is correctly set.
+   Renders the node from an image of its subtree rasterized in device space.
+   The image is reused while the subtree, the inherited paint and the scale
+   and skew of the canvas are unchanged, translations only offset it. The
+   subtree is recorded in device space, so rasterized descendants see the
+   same matrix as when drawn directly.
    */
-  virtual void renderNode(DrawingContext *context) = 0;
+  void renderRasterized(DrawingContext *context) {
+    auto canvas = context->getCanvas();
+    auto matrix = canvas->getTotalMatrix();
+    if (matrix.hasPerspective()) {
+      renderUnretained(context);
+      return;
+    }
 
-  /**
-   Define common properties for all render nodes
-   */
-  void defineProperties(NodePropsContainer *container) override {
-    JsiDomNode::defineProperties(container);
+    auto version = getSubtreeVersion();
+    auto parentPaintVersion = context->getPaintVersion();
+    sk_sp<SkImage> image;
+    if (_rasterCache.version == version &&
+        _rasterCache.parentPaintVersion == parentPaintVersion &&
+        hasSameScaleAndSkew(_rasterCache.matrix, matrix)) {
+      if (_rasterCache.deviceBounds.isEmpty()) {
+        // The subtree could not be rasterized in this state
+        renderUnretained(context);
+        return;
+      }
+      image = _rasterCache.getImage(context->getRasterCache());
+    }
 
-    _paintProps = container->defineProperty<PaintProps>();
+    if (image == nullptr) {
+      // Record the subtree first to find its device bounds, including the
+      // space needed by blurs and shadows.
+      SkPictureRecorder recorder;
+      SkRTreeFactory factory;
+      auto recordingCanvas =
+          recorder.beginRecording(SkRect::MakeLargest(), &factory);
+      recordingCanvas->setMatrix(matrix);
+      auto isCullingToDamage = context->isCullingToDamage();
+      auto isRecording = context->isRecording();
+      context->setCanvas(recordingCanvas);
+      context->setCullingToDamage(false);
+      context->setRecording(true);
+      try {
+        renderUnretained(context);
+      } catch (...) {
+        context->setCanvas(canvas);
+        context->setCullingToDamage(isCullingToDamage);
+        context->setRecording(isRecording);
+        throw;
+      }
+      context->setCanvas(canvas);
+      context->setCullingToDamage(isCullingToDamage);
+      context->setRecording(isRecording);
+      auto picture = recorder.finishRecordingAsPicture();
+
+      _rasterCache.clear();
+      _rasterCache.version = version;
+      _rasterCache.parentPaintVersion = parentPaintVersion;
+      _rasterCache.matrix = matrix;
+      _rasterCache.deviceBounds = SkIRect::MakeEmpty();
+
+      auto bounds = picture->cullRect().roundOut();
+      sk_sp<SkSurface> surface;
+      if (!bounds.isEmpty() && bounds.width() <= MaxRasterSize &&
+          bounds.height() <= MaxRasterSize) {
+        auto info = SkImageInfo::MakeN32Premul(bounds.width(), bounds.height());
+        surface = context->makeSurface(info);
+      }
+      if (surface == nullptr) {
+        canvas->save();
+        canvas->resetMatrix();
+        canvas->drawPicture(picture);
+        canvas->restore();
+        return;
+      }
 
-    _matrixProp = container->defineProperty<MatrixProp>("matrix");
-    _transformProp = container->defineProperty<TransformProp>("transform");
-    _originProp = container->defineProperty<PointProp>("origin");
-    _clipProp = container->defineProperty<ClipProp>("clip");
-    _invertClip = container->defineProperty<NodeProp>("invertClip");
-    _layerProp = container->defineProperty<LayerProp>("layer");
-  }
+#if SKIA_DOM_DEBUG
+      printDebugInfo("Rasterizing " + std::to_string(bounds.width()) + "x" +
+                     std::to_string(bounds.height()));
+#endif
+      auto rasterCanvas = surface->getCanvas();
+      rasterCanvas->clear(SK_ColorTRANSPARENT);
+      rasterCanvas->translate(-bounds.x(), -bounds.y());
+      rasterCanvas->drawPicture(picture);
+      image = surface->makeImageSnapshot();
+      _rasterCache.deviceBounds = bounds;
+      _rasterCache.setImage(context->getRasterCache(), image);
+    }
 
-  /**
-   Validates that only declaration nodes can be children
-   */
-  void addChild(std::shared_ptr<JsiDomNode> child) override {
-    JsiDomNode::addChild(child);
-    _paintCache.parent = nullptr;
-    _paintCache.child = nullptr;
+    // Draw in device space, offset by how much the node has moved
+    auto dx = matrix.getTranslateX() - _rasterCache.matrix.getTranslateX();
+    auto dy = matrix.getTranslateY() - _rasterCache.matrix.getTranslateY();
+    canvas->save();
+    canvas->resetMatrix();
+    canvas->drawImage(image, _rasterCache.deviceBounds.x() + dx,
+                      _rasterCache.deviceBounds.y() + dy,
+                      SkSamplingOptions(SkFilterMode::kLinear));
+    canvas->restore();
   }
 
-  /**
-   Validates that only declaration nodes can be children
-   */
-  void insertChildBefore(std::shared_ptr<JsiDomNode> child,
-                         std::shared_ptr<JsiDomNode> before) override {
-    JsiDomNode::insertChildBefore(child, before);
-    _paintCache.parent = nullptr;
-    _paintCache.child = nullptr;
+  static bool hasSameScaleAndSkew(const SkMatrix &a, const SkMatrix &b) {
+    return a.getScaleX() == b.getScaleX() && a.getScaleY() == b.getScaleY() &&
+           a.getSkewX() == b.getSkewX() && a.getSkewY() == b.getSkewY();
   }
 
-  /**
-   A property changed
-   */
-  void onPropertyChanged(BaseNodeProp *prop) override {
-    static std::vector<const char *> paintProps = {
-        JsiPropId::get("color"),      JsiPropId::get("strokeWidth"),
-        JsiPropId::get("blendMode"),  JsiPropId::get("strokeCap"),
-        JsiPropId::get("strokeJoin"), JsiPropId::get("strokeMiter"),
-        JsiPropId::get("style"),      JsiPropId::get("antiAlias"),
-        JsiPropId::get("opacity")};
-
-    // We'll invalidate paint if a prop change happened in a paint property
-    if (std::find(paintProps.begin(), paintProps.end(), prop->getName()) !=
-        paintProps.end()) {
-      invalidateContext();
-    }
-  }
-
-private:
   /**
    Clips the canvas depending on the clip property
    */
@@ -241,15 +593,75 @@ private:
 
   struct PaintCache {
     void clear() {
-      parent = nullptr;
-      child = nullptr;
+      paint = nullptr;
+      isSet = false;
+      version = 0;
+      parentVersion = 0;
     }
-    std::shared_ptr<SkPaint> parent;
-    std::shared_ptr<SkPaint> child;
+    // Paint of the node compiled on top of the inherited paint, patched in
+    // place when recompiled
+    std::shared_ptr<SkPaint> paint;
+    // False if the node doesn't change the inherited paint
+    bool isSet = false;
+    size_t version = 0;
+    // Version of the inherited paint the paint was compiled on
+    size_t parentVersion = 0;
   };
 
   PaintCache _paintCache;
 
+  struct MatrixCache {
+    // Matrix applied to the canvas, valid if isSet
+    SkMatrix matrix;
+    bool isSet = false;
+  };
+
+  MatrixCache _matrixCache;
+
+  struct LayerCache {
+    // True if the layer paint can change pixels outside of the children
+    bool isUnbounded = false;
+  };
+
+  LayerCache _layerCache;
+
+  // Number of unchanged frames before a subtree is recorded into a picture
+  static constexpr size_t RetainAfterUnchangedFrames = 5;
+
+  struct PictureCache {
+    void clear() {
+      version = 0;
+      unchangedFrames = 0;
+      parentPaintVersion = 0;
+      picture = nullptr;
+    }
+    size_t version = 0;
+    size_t unchangedFrames = 0;
+    size_t parentPaintVersion = 0;
+    sk_sp<SkPicture> picture;
+  };
+
+  PictureCache _pictureCache;
+
+  // Largest width or height of a rasterized subtree in device pixels
+  static constexpr int MaxRasterSize = 4096;
+
+  RasterCacheEntry _rasterCache;
+
+  struct DamageState {
+    // Device space bounds of the subtree when it was last measured
+    SkRect bounds = SkRect::MakeEmpty();
+    bool isMeasured = false;
+  };
+
+  DamageState _damageState;
+
+  // Cached by the commit pass
+  bool _isRecordable = false;
+  bool _hasVolatileSubtree = false;
+  bool _subtreeReadsBackdrop = false;
+  bool _hasRenderChildren = false;
+
   PointProp *_originProp;
   MatrixProp *_matrixProp;
   TransformProp *_transformProp;
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace RNSkia {
+
+class JsiDomNode;
+
+enum class NodeOpType {
+  AddChild,
+  InsertChildBefore,
+  RemoveChild,
+};
+
+/**
+ A change to a node made on the JS thread and applied by the render thread in
+ the next commit
+ */
+struct NodeOp {
+  NodeOpType type = NodeOpType::AddChild;
+  std::shared_ptr<JsiDomNode> child;
+  std::shared_ptr<JsiDomNode> before;
+};
+
+/**
+ Single producer, single consumer queue of node operations. The JS thread
+ pushes operations and the render thread drains them without taking a lock.
+ Operations are stored in blocks that double in size up to a limit, so pushing
+ only allocates once per block, and a drained block is reused by the next one.
+ */
+class NodeOpQueue {
+public:
+  NodeOpQueue() : _tail(&_sentinel), _head(&_sentinel) {}
+  NodeOpQueue(const NodeOpQueue &) = delete;
+  NodeOpQueue &operator=(const NodeOpQueue &) = delete;
+
+  ~NodeOpQueue() {
+    auto block = _head;
+    while (block != nullptr) {
+      auto next = block->next.load(std::memory_order_relaxed);
+      if (block != &_sentinel) {
+        delete block;
+      }
+      block = next;
+    }
+    delete _spare.load(std::memory_order_relaxed);
+  }
+
+  /**
+   Adds an operation to the queue. Only called from the producer thread.
+   */
+  void push(NodeOp &&op) {
+    auto count = _tail->count.load(std::memory_order_relaxed);
+    if (count == _tail->capacity) {
+      auto capacity = std::min(
+          std::max(_tail->capacity * 2, MinBlockCapacity), MaxBlockCapacity);
+      auto block = _spare.exchange(nullptr, std::memory_order_acquire);
+      if (block != nullptr && block->capacity < capacity) {
+        delete block;
+        block = nullptr;
+      }
+      if (block == nullptr) {
+        block = new Block(capacity);
+      }
+      _tail->next.store(block, std::memory_order_release);
+      _tail = block;
+      count = 0;
+    }
+    _tail->ops[count] = std::move(op);
+    _tail->count.store(count + 1, std::memory_order_release);
+  }
+
+  /**
+   Calls the function with each queued operation in the order they were
+   pushed, and returns the number of operations. Only called from the consumer
+   thread.
+   */
+  template <typename F> size_t drain(F &&f) {
+    size_t drained = 0;
+    while (true) {
+      auto count = _head->count.load(std::memory_order_acquire);
+      while (_headIndex < count) {
+        auto op = std::move(_head->ops[_headIndex++]);
+        drained++;
+        f(op);
+      }
+      // The producer keeps writing to the block until it is full
+      if (_headIndex < _head->capacity) {
+        break;
+      }
+      auto next = _head->next.load(std::memory_order_acquire);
+      if (next == nullptr) {
+        break;
+      }
+      recycle(_head);
+      _head = next;
+      _headIndex = 0;
+    }
+    return drained;
+  }
+
+  /**
+   Drops all queued operations. Only called from the consumer thread.
+   */
+  void clear() {
+    drain([](NodeOp &) {});
+  }
+
+private:
+  struct Block {
+    explicit Block(size_t capacity)
+        : capacity(capacity),
+          ops(capacity > 0 ? new NodeOp[capacity] : nullptr) {}
+
+    const size_t capacity;
+    std::unique_ptr<NodeOp[]> ops;
+    // Number of operations written by the producer
+    std::atomic<size_t> count = {0};
+    std::atomic<Block *> next = {nullptr};
+  };
+
+  void recycle(Block *block) {
+    if (block == &_sentinel) {
+      return;
+    }
+    block->count.store(0, std::memory_order_relaxed);
+    block->next.store(nullptr, std::memory_order_relaxed);
+    Block *expected = nullptr;
+    if (!_spare.compare_exchange_strong(expected, block,
+                                        std::memory_order_release)) {
+      delete block;
+    }
+  }
+
+  static constexpr size_t MinBlockCapacity = 4;
+  static constexpr size_t MaxBlockCapacity = 1024;
+
+  // Empty block the queue starts with, so that nodes without operations don't
+  // allocate
+  Block _sentinel{0};
+  // Block the producer writes to
+  Block *_tail;
+  // Block and index the consumer reads from
+  Block *_head;
+  size_t _headIndex = 0;
+  // Drained block handed back to the producer
+  std::atomic<Block *> _spare = {nullptr};
+};
+
+} // namespace RNSkia
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "BaseNodeProp.h"
+#include "JsiSkHostObjects.h"
 #include "JsiValue.h"
 
 #include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace RNSkia {
 
@@ -20,38 +23,48 @@ public:
   /**
    Constructs a new optional dom node properrty
    */
-  explicit NodeProp(const std::string &name,
+  explicit NodeProp(PropId name,
                     const std::function<void(BaseNodeProp *)> &onChange)
-      : _name(JsiPropId::get(name)), _onChange(onChange), BaseNodeProp() {}
+      : _name(name), _onChange(onChange), BaseNodeProp() {}
 
   /**
    Reads JS value and swaps out with a new value
    */
   void readValueFromJs(jsi::Runtime &runtime,
                        const ReadPropFunc &read) override {
-    // If the value is a nullptr this is the first call to the
-    // readValueFromJS Function (which comes from the reconciler
-    // setting a new property value on the property
-    if (_value == nullptr) {
-      _value = std::make_unique<JsiValue>(runtime, read(runtime, _name, this));
+    setValueFromJs(runtime, read(runtime, _name, this));
+  }
+
+  /**
+   Sets the value read from the props object set by the reconciler
+   */
+  void setValueFromJs(jsi::Runtime &runtime, const jsi::Value &value) {
+    // If we have no value yet this is the first value set by the reconciler
+    if (!_hasValue) {
+      _value.setCurrent(runtime, value);
+      _hasValue = true;
       _isChanged = true;
       _hasNewValue = false;
+      updateMutableValue();
     } else {
-      // Otherwise we'll just update the buffer and commit it later.
+      // Otherwise we'll just update the buffer and commit it later. The buffer
+      // holds the previous value and its storage is reused.
       std::lock_guard<std::mutex> lock(_swapMutex);
-      if (_buffer == nullptr) {
-        _buffer =
-            std::make_unique<JsiValue>(runtime, read(runtime, _name, this));
-      } else {
-        _buffer->setCurrent(runtime, read(runtime, _name, this));
-      }
-      _hasNewValue = *_buffer.get() != *_value.get();
+      _buffer.setCurrent(runtime, value);
+      _hasNewValue = _buffer != _value;
       if (_hasNewValue && _onChange != nullptr) {
         _onChange(this);
       }
     }
   }
 
+  /**
+   Adds this property to the list of properties reading by name
+   */
+  void collectNodeProps(std::vector<NodeProp *> &props) override {
+    props.push_back(this);
+  }
+
   /**
    Property value has changed - let's save this as a change to be commited later
    */
@@ -59,11 +72,7 @@ public:
     // Always use the next field since this method is called on the JS thread
     // and we don't want to rip out the underlying value object.
     std::lock_guard<std::mutex> lock(_swapMutex);
-    if (_buffer == nullptr) {
-      _buffer = std::make_unique<JsiValue>(runtime, value);
-    } else {
-      _buffer->setCurrent(runtime, value);
-    }
+    _buffer.setCurrent(runtime, value);
     // This is almost always a change - meaning a swap is
     // cheaper than comparing for equality.
     _hasNewValue = true;
@@ -75,9 +84,7 @@ public:
   /**
    Returns true if the property is set and is not undefined or null
    */
-  bool isSet() override {
-    return _value != nullptr && !_value->isUndefinedOrNull();
-  }
+  bool isSet() override { return !_value.isUndefinedOrNull(); }
 
   /**
    True if the property has changed since we last visited it
@@ -90,11 +97,11 @@ public:
   void updatePendingChanges() override {
     // If the value has changed we should swap the
     // buffers
-    if (_hasNewValue && _buffer != nullptr) {
+    if (_hasNewValue) {
       {
         // Swap buffers
         std::lock_guard<std::mutex> lock(_swapMutex);
-        _value.swap(_buffer);
+        std::swap(_value, _buffer);
 
         // turn off pending changes flag
         _hasNewValue = false;
@@ -102,13 +109,36 @@ public:
 
       // Mark as changed.
       _isChanged = true;
+      updateMutableValue();
+    } else if (_mutableValue != nullptr) {
+      // The host object of the value may have been changed in place
+      auto generation = _mutableValue->getGeneration();
+      if (generation != _mutableGeneration) {
+        _mutableGeneration = generation;
+        _isChanged = true;
+        _isMutated = true;
+      }
     }
   }
 
   /*
    Ends the visit cycle
    */
-  void markAsResolved() override { _isChanged = false; }
+  void markAsResolved() override {
+    _isChanged = false;
+    _isMutated = false;
+  }
+
+  /**
+   Returns true if the value is a host object that JS can change in place
+   */
+  bool hasMutableValue() { return _mutableValue != nullptr; }
+
+  /**
+   True if the host object of the value was changed in place since we last
+   visited it
+   */
+  bool isMutated() { return _isMutated; }
 
   /**
    Returns pointer to the value contained by the property if the property is
@@ -116,7 +146,7 @@ public:
    */
   const JsiValue &value() {
     assert(isSet());
-    return *_value;
+    return _value;
   }
 
   /**
@@ -124,13 +154,36 @@ public:
    */
   std::string getName() override { return std::string(_name); }
 
+  /**
+   Returns the interned name of the property
+   */
+  PropId getPropId() const { return _name; }
+
 private:
+  /**
+   Keeps track of the host object of the value if JS can change it in place
+   */
+  void updateMutableValue() {
+    _mutableValue = _value.getType() == PropType::HostObject
+                        ? dynamic_cast<JsiSkMutableHostObject *>(
+                              _value.getAsHostObject().get())
+                        : nullptr;
+    _mutableGeneration =
+        _mutableValue != nullptr ? _mutableValue->getGeneration() : 0;
+    _isMutated = false;
+  }
+
   PropId _name;
 
   std::function<void(BaseNodeProp *)> _onChange;
 
-  std::unique_ptr<JsiValue> _value;
-  std::unique_ptr<JsiValue> _buffer;
+  JsiValue _value;
+  JsiValue _buffer;
+  bool _hasValue = false;
+  // Host object of the value, owned by the value
+  JsiSkMutableHostObject *_mutableValue = nullptr;
+  size_t _mutableGeneration = 0;
+  bool _isMutated = false;
   std::atomic<bool> _isChanged = {false};
   std::atomic<bool> _hasNewValue = {false};
   std::mutex _swapMutex;
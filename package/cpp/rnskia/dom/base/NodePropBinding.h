@@ -0,0 +1,95 @@
+#pragma once
+
+#include "JsiValue.h"
+#include "RNSkReadonlyValue.h"
+
+#include <algorithm>
+#include <string>
+
+namespace RNSkia {
+
+namespace jsi = facebook::jsi;
+
+/**
+ Native transform from the value of an animated value to the value of a prop.
+ The transform picks an element if the value is an array, then scales, offsets
+ and clamps numbers. Values that are not numbers are passed through after
+ picking the element. Bindings are evaluated without running any JS.
+ */
+class NodePropBinding {
+public:
+  /**
+   Reads the transform from a binding descriptor: { scale?, offset?, index?,
+   clamp?: [min, max] }
+   */
+  explicit NodePropBinding(const JsiValue &binding) {
+    if (binding.getType() != PropType::Object) {
+      return;
+    }
+    if (binding.hasValue(PropNameScale)) {
+      _scale = binding.getValue(PropNameScale).getAsNumber();
+    }
+    if (binding.hasValue(PropNameOffset)) {
+      _offset = binding.getValue(PropNameOffset).getAsNumber();
+    }
+    if (binding.hasValue(PropNameIndex)) {
+      auto index = binding.getValue(PropNameIndex).getAsNumber();
+      if (index >= 0) {
+        _index = static_cast<int>(index);
+      }
+    }
+    if (binding.hasValue(PropNameClamp)) {
+      auto &clamp = binding.getValue(PropNameClamp).getAsArray();
+      if (clamp.size() == 2) {
+        _hasClamp = true;
+        _min = clamp[0].getAsNumber();
+        _max = clamp[1].getAsNumber();
+      }
+    }
+  }
+
+  /**
+   Returns the prop value for the current value of the animated value
+   */
+  jsi::Value apply(jsi::Runtime &runtime, RNSkReadonlyValue &value) const {
+    // Numbers are read from the value holder without creating a JS value
+    auto holder = value.getCurrent();
+    if (_index == -1 &&
+        holder->getType() == RNJsi::JsiWrapperValueType::Number) {
+      return jsi::Value(transform(holder->getAsNumber()));
+    }
+
+    auto current = value.getCurrent(runtime);
+    if (_index != -1 && current.isObject()) {
+      auto object = current.asObject(runtime);
+      if (object.isArray(runtime)) {
+        current = object.asArray(runtime).getValueAtIndex(runtime, _index);
+      } else {
+        // Typed arrays
+        current = object.getProperty(runtime, std::to_string(_index).c_str());
+      }
+    }
+    if (current.isNumber()) {
+      return jsi::Value(transform(current.asNumber()));
+    }
+    return current;
+  }
+
+private:
+  double transform(double value) const {
+    auto result = value * _scale + _offset;
+    if (_hasClamp) {
+      result = std::min(std::max(result, _min), _max);
+    }
+    return result;
+  }
+
+  double _scale = 1;
+  double _offset = 0;
+  int _index = -1;
+  bool _hasClamp = false;
+  double _min = 0;
+  double _max = 0;
+};
+
+} // namespace RNSkia
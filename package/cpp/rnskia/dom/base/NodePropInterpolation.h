@@ -0,0 +1,206 @@
+#pragma once
+
+#include "JsiValue.h"
+#include "RNSkReadonlyValue.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkColor.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+namespace jsi = facebook::jsi;
+
+/**
+ Native evaluation of an interpolation selector. Mirrors interpolate and
+ interpolateColors from the animation functions so that the prop gets the same
+ value as when the selector runs in JS. The output range is either numbers,
+ arrays of numbers interpolated element-wise, or colors given as arrays of rgba
+ floats.
+ */
+class NodePropInterpolation {
+public:
+  enum class Extrapolate { Extend, Clamp, Identity };
+
+  /**
+   Reads the interpolation from a descriptor: { inputRange, outputRange,
+   extrapolateLeft, extrapolateRight, color? }
+   */
+  explicit NodePropInterpolation(const JsiValue &interpolation) {
+    auto &inputRange = interpolation.getValue(PropNameInputRange).getAsArray();
+    for (auto &input : inputRange) {
+      _input.push_back(input.getAsNumber());
+    }
+    auto &outputRange =
+        interpolation.getValue(PropNameOutputRange).getAsArray();
+    if (!outputRange.empty() && outputRange[0].getType() == PropType::Array) {
+      _components = outputRange[0].getAsArray().size();
+      _isArray = true;
+      if (_components == 0) {
+        throw std::runtime_error("Interpolation outputs should not be empty.");
+      }
+    }
+    for (auto &output : outputRange) {
+      if (_isArray) {
+        auto &elements = output.getAsArray();
+        if (elements.size() != _components) {
+          throw std::runtime_error(
+              "Interpolation outputs should have the same length.");
+        }
+        for (auto &element : elements) {
+          _output.push_back(element.getAsNumber());
+        }
+      } else {
+        _output.push_back(output.getAsNumber());
+      }
+    }
+    if (_input.size() < 2 || _output.size() / _components < 2) {
+      throw std::runtime_error(
+          "Interpolation input and output should contain at least two values.");
+    }
+    _extrapolateLeft =
+        getExtrapolate(interpolation.getValue(PropNameExtrapolateLeft));
+    _extrapolateRight =
+        getExtrapolate(interpolation.getValue(PropNameExtrapolateRight));
+    _isColor = interpolation.hasValue(PropNameColor) &&
+               interpolation.getValue(PropNameColor).getAsBool();
+    if (_isColor && _components != 4) {
+      throw std::runtime_error("Color interpolation expects rgba outputs.");
+    }
+  }
+
+  /**
+   Returns the prop value for the current value of the animated value
+   */
+  jsi::Value apply(jsi::Runtime &runtime, RNSkReadonlyValue &value) const {
+    // Non numeric values are NaN like in JS arithmetic
+    auto x = std::numeric_limits<double>::quiet_NaN();
+    auto holder = value.getCurrent();
+    if (holder->getType() == RNJsi::JsiWrapperValueType::Number) {
+      x = holder->getAsNumber();
+    }
+
+    auto segment = getSegment(x);
+    if (_isColor) {
+      // Same rounding as the Float32Array returned by interpolateColors and
+      // the conversion in ColorProp
+      double rgba[4];
+      for (size_t i = 0; i < 4; ++i) {
+        rgba[i] = static_cast<float>(evaluate(x, segment, i, Extrapolate::Clamp,
+                                              Extrapolate::Clamp));
+      }
+      auto color = SkColorSetARGB(rgba[3] * 255.0f, rgba[0] * 255.0f,
+                                  rgba[1] * 255.0f, rgba[2] * 255.0f);
+      return jsi::Value(static_cast<double>(color));
+    }
+    if (_isArray) {
+      auto result = jsi::Array(runtime, _components);
+      for (size_t i = 0; i < _components; ++i) {
+        result.setValueAtIndex(
+            runtime, i,
+            evaluate(x, segment, i, _extrapolateLeft, _extrapolateRight));
+      }
+      return result;
+    }
+    return jsi::Value(
+        evaluate(x, segment, 0, _extrapolateLeft, _extrapolateRight));
+  }
+
+private:
+  static Extrapolate getExtrapolate(const JsiValue &value) {
+    if (value.getType() != PropType::String) {
+      return Extrapolate::Extend;
+    }
+    auto &type = value.getAsString();
+    if (type == "clamp") {
+      return Extrapolate::Clamp;
+    } else if (type == "identity") {
+      return Extrapolate::Identity;
+    }
+    return Extrapolate::Extend;
+  }
+
+  /**
+   Returns the index of the input range segment used for x
+   */
+  size_t getSegment(double x) const {
+    auto length = _input.size();
+    if (length > 2) {
+      if (x > _input[length - 1]) {
+        return length - 2;
+      }
+      for (size_t i = 1; i < length; ++i) {
+        if (x <= _input[i]) {
+          return i - 1;
+        }
+      }
+    }
+    return 0;
+  }
+
+  /**
+   Interpolates one component of the output
+   */
+  double evaluate(double x, size_t segment, size_t component,
+                  Extrapolate extrapolateLeft,
+                  Extrapolate extrapolateRight) const {
+    // Fused multiply-adds would round differently from JS
+#pragma clang fp contract(off)
+    double leftEdgeInput = _input[segment];
+    double rightEdgeInput = _input[segment + 1];
+    double leftEdgeOutput = _output[segment * _components + component];
+    double rightEdgeOutput = _output[(segment + 1) * _components + component];
+    if (rightEdgeInput - leftEdgeInput == 0) {
+      return leftEdgeOutput;
+    }
+    double progress = (x - leftEdgeInput) / (rightEdgeInput - leftEdgeInput);
+    double val = leftEdgeOutput + progress * (rightEdgeOutput - leftEdgeOutput);
+    double coef = rightEdgeOutput >= leftEdgeOutput ? 1 : -1;
+
+    if (coef * val < coef * leftEdgeOutput) {
+      return extrapolate(extrapolateLeft, coef, val, leftEdgeOutput,
+                         rightEdgeOutput, x);
+    } else if (coef * val > coef * rightEdgeOutput) {
+      return extrapolate(extrapolateRight, coef, val, leftEdgeOutput,
+                         rightEdgeOutput, x);
+    }
+    return val;
+  }
+
+  static double extrapolate(Extrapolate type, double coef, double val,
+                            double leftEdgeOutput, double rightEdgeOutput,
+                            double x) {
+    switch (type) {
+    case Extrapolate::Identity:
+      return x;
+    case Extrapolate::Clamp:
+      if (coef * val < coef * leftEdgeOutput) {
+        return leftEdgeOutput;
+      }
+      return rightEdgeOutput;
+    case Extrapolate::Extend:
+    default:
+      return val;
+    }
+  }
+
+  std::vector<double> _input;
+  // Outputs of all components, one input value after the other
+  std::vector<double> _output;
+  size_t _components = 1;
+  bool _isArray = false;
+  bool _isColor = false;
+  Extrapolate _extrapolateLeft = Extrapolate::Extend;
+  Extrapolate _extrapolateRight = Extrapolate::Extend;
+};
+
+} // namespace RNSkia
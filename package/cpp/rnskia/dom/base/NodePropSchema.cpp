@@ -0,0 +1,74 @@
+#include "NodePropSchema.h"
+#include "NodeProp.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace RNSkia {
+
+NodePropSchema::NodePropSchema(const std::vector<NodeProp *> &props,
+                               const NodeInvalidationsFunc &getInvalidations) {
+  std::vector<size_t> counts;
+  for (auto prop : props) {
+    auto name = prop->getPropId();
+    if (name.id() >= _slotById.size()) {
+      _slotById.resize(name.id() + 1, -1);
+    }
+    auto &slot = _slotById[name.id()];
+    if (slot == -1) {
+      slot = static_cast<int>(_names.size());
+      _names.push_back(name);
+      _invalidations.push_back(getInvalidations(name));
+      counts.push_back(0);
+    }
+    counts[slot]++;
+  }
+  _offsets.reserve(counts.size() + 1);
+  _offsets.push_back(0);
+  for (auto count : counts) {
+    _offsets.push_back(_offsets.back() + count);
+  }
+}
+
+bool NodePropSchema::matches(const std::vector<NodeProp *> &props) const {
+  if (props.size() != getPropCount()) {
+    return false;
+  }
+  std::vector<size_t> counts(getSlotCount(), 0);
+  for (auto prop : props) {
+    auto slot = getSlot(prop->getPropId());
+    if (slot == -1 ||
+        ++counts[slot] > _offsets[slot + 1] - _offsets[slot]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::shared_ptr<const NodePropSchema>
+NodePropSchema::forType(const char *type, const std::vector<NodeProp *> &props,
+                        const NodeInvalidationsFunc &getInvalidations) {
+  // Nodes can be created from more than one runtime. The registry is never
+  // destroyed so that schemas stay valid during static destruction.
+  static std::mutex mutex;
+  static auto schemas = new std::unordered_map<
+      std::string, std::shared_ptr<const NodePropSchema>>();
+
+  std::shared_ptr<const NodePropSchema> schema;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &entry = (*schemas)[type];
+    if (entry == nullptr) {
+      entry = std::make_shared<const NodePropSchema>(props, getInvalidations);
+      return entry;
+    }
+    schema = entry;
+  }
+  if (schema->matches(props)) {
+    return schema;
+  }
+  return std::make_shared<const NodePropSchema>(props, getInvalidations);
+}
+
+} // namespace RNSkia
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "JsiPropId.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace RNSkia {
+
+using namespace RNJsi; // NOLINT
+
+class NodeProp;
+
+/**
+ Cached state of a node that a prop change can invalidate. Each node type
+ declares which of them a change to each of its props invalidates.
+ */
+enum NodeInvalidation : uint32_t {
+  InvalidatesNone = 0,
+  // Paint composed from the paint props and declarations
+  InvalidatesPaint = 1 << 0,
+  // Matrix composed from the matrix, transform and origin props
+  InvalidatesMatrix = 1 << 1,
+  // Geometry resolved from the props, like paths
+  InvalidatesGeometry = 1 << 2,
+  // Shaders made by shader declarations
+  InvalidatesShader = 1 << 3,
+  // Local bounds used for culling
+  InvalidatesBounds = 1 << 4,
+  // Layer paint and rasterized image
+  InvalidatesLayer = 1 << 5,
+  InvalidatesAll = (1 << 6) - 1,
+};
+
+using NodeInvalidationMask = uint32_t;
+
+/**
+ Returns what a change to the prop with the given name invalidates
+ */
+using NodeInvalidationsFunc = std::function<NodeInvalidationMask(PropId)>;
+
+/**
+ Maps the names read by the props of a node type to slot indices. A schema is
+ built once per node type from the props defined by its first instance and is
+ immutable afterwards. Several props reading the same name share a slot, and
+ the props of a node instance are laid out in slot order so that the slot
+ ranges of the schema can be used to index them.
+ */
+class NodePropSchema {
+public:
+  /**
+   Builds a schema from the leaf props of a node in definition order
+   */
+  NodePropSchema(const std::vector<NodeProp *> &props,
+                 const NodeInvalidationsFunc &getInvalidations);
+
+  /**
+   Returns the shared schema for the given node type, creating it from the
+   props of the node if this is the first node of that type. If the props of
+   the node do not match the schema of the type a schema private to the node
+   is returned.
+   */
+  static std::shared_ptr<const NodePropSchema>
+  forType(const char *type, const std::vector<NodeProp *> &props,
+          const NodeInvalidationsFunc &getInvalidations);
+
+  /**
+   Returns the slot for the given name, or -1 if no prop reads that name
+   */
+  int getSlot(PropId name) const {
+    auto id = name.id();
+    return id < _slotById.size() ? _slotById[id] : -1;
+  }
+
+  /**
+   Returns what a change to a prop reading the given name invalidates
+   */
+  NodeInvalidationMask getInvalidations(PropId name) const {
+    auto slot = getSlot(name);
+    return slot != -1 ? _invalidations[slot] : InvalidatesNone;
+  }
+
+  /**
+   Returns what changes to any of the props invalidate
+   */
+  NodeInvalidationMask getAllInvalidations() const {
+    NodeInvalidationMask all = InvalidatesNone;
+    for (auto invalidations : _invalidations) {
+      all |= invalidations;
+    }
+    return all;
+  }
+
+  /**
+   Returns the number of slots
+   */
+  size_t getSlotCount() const { return _names.size(); }
+
+  /**
+   Returns the name read by the props in the given slot
+   */
+  PropId getSlotName(size_t slot) const { return _names[slot]; }
+
+  /**
+   Returns the index of the first prop of a slot in the slot ordered props
+   list of a node. The props of slot n end where slot n + 1 begins.
+   */
+  size_t getSlotOffset(size_t slot) const { return _offsets[slot]; }
+
+  /**
+   Returns the number of props in a node with this schema
+   */
+  size_t getPropCount() const { return _offsets.back(); }
+
+  /**
+   Returns true if the props of a node can be laid out with this schema
+   */
+  bool matches(const std::vector<NodeProp *> &props) const;
+
+private:
+  std::vector<int> _slotById;
+  std::vector<PropId> _names;
+  std::vector<NodeInvalidationMask> _invalidations;
+  std::vector<size_t> _offsets;
+};
+
+} // namespace RNSkia
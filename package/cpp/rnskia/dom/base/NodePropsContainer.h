@@ -3,8 +3,9 @@
 #include "DrawingContext.h"
 #include "JsiValue.h"
 #include "NodeProp.h"
+#include "NodePropSchema.h"
 
-#include <map>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -12,6 +13,46 @@
 
 namespace RNSkia {
 
+/**
+ The props of a node reading the same name
+ */
+class NodePropSlot {
+public:
+  NodePropSlot(PropId name, NodeProp *const *begin, NodeProp *const *end)
+      : _name(name), _begin(begin), _end(end) {}
+
+  /**
+   Returns the name read by the props in this slot
+   */
+  PropId getName() const { return _name; }
+
+  NodeProp *const *begin() const { return _begin; }
+  NodeProp *const *end() const { return _end; }
+
+  /**
+   Updates the value of all props in the slot
+   */
+  void updateValue(jsi::Runtime &runtime, const jsi::Value &value) const {
+    for (auto prop : *this) {
+      prop->updateValue(runtime, value);
+    }
+  }
+
+  /**
+   Sets the value read from the props object on all props in the slot
+   */
+  void setValueFromJs(jsi::Runtime &runtime, const jsi::Value &value) const {
+    for (auto prop : *this) {
+      prop->setValueFromJs(runtime, value);
+    }
+  }
+
+private:
+  PropId _name;
+  NodeProp *const *_begin;
+  NodeProp *const *_end;
+};
+
 /**
  This class manages marshalling from JS values over JSI to C++ values and is
  typically called when a new node is created or an existing node is updated from
@@ -23,7 +64,7 @@ public:
    Constructor for the node prop container
    */
   explicit NodePropsContainer(
-      PropId componentType,
+      const char *componentType,
       const std::function<void(BaseNodeProp *)> &onPropChanged)
       : _onPropChanged(onPropChanged), _type(componentType) {}
 
@@ -41,25 +82,122 @@ public:
   }
 
   /**
-   Returns a list of mappings betwen property names and property objects
+   Lays out the props in the slots of the schema for the node type. Called once
+   all properties are defined.
+   */
+  void initializeSlots(const NodeInvalidationsFunc &getInvalidations) {
+    std::vector<NodeProp *> props;
+    for (auto &prop : _properties) {
+      prop->collectNodeProps(props);
+    }
+    _schema = NodePropSchema::forType(_type, props, getInvalidations);
+    _slotProps.resize(props.size());
+    std::vector<size_t> next(_schema->getSlotCount());
+    for (size_t slot = 0; slot < next.size(); ++slot) {
+      next[slot] = _schema->getSlotOffset(slot);
+    }
+    for (auto prop : props) {
+      _slotProps[next[_schema->getSlot(prop->getPropId())]++] = prop;
+    }
+
+    // Until the first props are set all props read undefined
+    auto slotCount = _schema->getSlotCount();
+    _setSlots.resize(slotCount);
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+      _setSlots[slot] = slot;
+    }
+    _nextSetSlots.reserve(slotCount);
+    _slotReads.assign(slotCount, 0);
+  }
+
+  /**
+   Returns what a change to the given prop invalidates
+   */
+  NodeInvalidationMask getInvalidations(const NodeProp *prop) const {
+    return _schema != nullptr ? _schema->getInvalidations(prop->getPropId())
+                              : InvalidatesNone;
+  }
+
+  /**
+   Returns what changes to any of the props invalidate
+   */
+  NodeInvalidationMask getAllInvalidations() const {
+    return _schema != nullptr ? _schema->getAllInvalidations()
+                              : InvalidatesNone;
+  }
+
+  /**
+   Returns the number of distinct names read by the props
+   */
+  size_t getSlotCount() const {
+    return _schema != nullptr ? _schema->getSlotCount() : 0;
+  }
+
+  /**
+   Returns the props reading the name of the given slot
+   */
+  NodePropSlot getSlot(size_t slot) const {
+    auto begin = _slotProps.data() + _schema->getSlotOffset(slot);
+    auto end = _slotProps.data() + _schema->getSlotOffset(slot + 1);
+    return NodePropSlot(_schema->getSlotName(slot), begin, end);
+  }
+
+  /**
+   Updates the value of the props reading the given name. Returns false if no
+   prop reads that name.
    */
-  const std::map<PropId, std::vector<NodeProp *>> &getMappedProperties() {
-    return _mappedProperties;
+  bool updateValue(jsi::Runtime &runtime, PropId name,
+                   const jsi::Value &value) {
+    auto slot = _schema != nullptr ? _schema->getSlot(name) : -1;
+    if (slot == -1) {
+      return false;
+    }
+    getSlot(slot).updateValue(runtime, value);
+    if (std::find(_setSlots.begin(), _setSlots.end(), slot) ==
+        _setSlots.end()) {
+      _setSlots.push_back(slot);
+    }
+    return true;
   }
 
   /**
    Updates any props that has changes waiting, updates props that have derived
-   values
+   values. Props holding host objects changed in place are marked as changed.
    */
   void updatePendingValues() {
     for (auto &prop : _properties) {
       prop->updatePendingChanges();
       if (!prop->isSet() && prop->isRequired()) {
         throw std::runtime_error("Missing one or more required properties " +
-                                 std::string(prop->getName()) + " in the " +
-                                 _type + " component.");
+                                 prop->getName() + " in the " + _type +
+                                 " component.");
+      }
+    }
+    _hasMutableValues = false;
+    for (auto prop : _slotProps) {
+      _hasMutableValues = _hasMutableValues || prop->hasMutableValue();
+    }
+  }
+
+  /**
+   Returns true if any prop holds a host object that JS can change in place,
+   as of the last update
+   */
+  bool hasMutableValues() const { return _hasMutableValues; }
+
+  /**
+   Returns what the props holding host objects changed in place invalidate
+   */
+  NodeInvalidationMask getMutationInvalidations() const {
+    NodeInvalidationMask invalidations = InvalidatesNone;
+    if (_hasMutableValues) {
+      for (auto prop : _slotProps) {
+        if (prop->isMutated()) {
+          invalidations |= getInvalidations(prop);
+        }
       }
     }
+    return invalidations;
   }
 
   /**
@@ -75,37 +213,54 @@ public:
    Clears all props and data from the container
    */
   void dispose() {
+    _hasMutableValues = false;
+    _setSlots.clear();
+    _nextSetSlots.clear();
+    _slotReads.clear();
+    _slotProps.clear();
     _properties.clear();
-    _mappedProperties.clear();
+    _schema = nullptr;
   }
 
   /**
    Called when the React / JS side sets properties on a node
    */
   void setProps(jsi::Runtime &runtime, const jsi::Value &maybePropsObject) {
-    // Clear property mapping
-    _mappedProperties.clear();
-
     if (!maybePropsObject.isObject()) {
       throw jsi::JSError(runtime, "Expected property object.");
     }
+    if (_schema == nullptr) {
+      // Disposed
+      return;
+    }
 
     auto props = maybePropsObject.asObject(runtime);
 
-    // Use specialized reader function to be able to intercept calls that
-    // reads specific named values from the js property object.
-    auto read = [&](jsi::Runtime &runtime, PropId name, NodeProp *prop) {
-      if (_mappedProperties.count(name) == 0) {
-        std::vector<NodeProp *> tmp;
-        _mappedProperties[name] = std::move(tmp);
+    // Only the keys present on the props object are read from JS, and only
+    // the props reading them are updated. Most of the declared props (paint,
+    // transform, ...) are usually not set, and reading them one by one would
+    // cost a JSI call each.
+    auto read = ++_readCount;
+    _nextSetSlots.clear();
+    auto names = props.getPropertyNames(runtime);
+    auto size = names.size(runtime);
+    for (size_t i = 0; i < size; ++i) {
+      auto key = names.getValueAtIndex(runtime, i).getString(runtime);
+      auto slot = _schema->getSlot(JsiPropId::get(key.utf8(runtime)));
+      if (slot != -1) {
+        getSlot(slot).setValueFromJs(runtime, props.getProperty(runtime, key));
+        _slotReads[slot] = read;
+        _nextSetSlots.push_back(slot);
       }
-      _mappedProperties.at(name).push_back(prop);
-      return props.getProperty(runtime, name);
-    };
+    }
 
-    for (auto &prop : _properties) {
-      prop->readValueFromJs(runtime, read);
+    // Props set before that are no longer present read undefined
+    for (auto slot : _setSlots) {
+      if (_slotReads[slot] != read) {
+        getSlot(slot).setValueFromJs(runtime, jsi::Value::undefined());
+      }
     }
+    _setSlots.swap(_nextSetSlots);
   }
 
   /**
@@ -127,8 +282,19 @@ public:
 private:
   std::function<void(BaseNodeProp *)> _onPropChanged;
   std::vector<std::shared_ptr<BaseNodeProp>> _properties;
-  std::map<PropId, std::vector<NodeProp *>> _mappedProperties;
-  PropId _type;
+  std::shared_ptr<const NodePropSchema> _schema;
+  // Leaf props ordered by slot
+  std::vector<NodeProp *> _slotProps;
+  // Slots set from JS, which setProps resets when they are missing from the
+  // props object. Reserved for all slots so that setting props doesn't
+  // allocate.
+  std::vector<size_t> _setSlots;
+  std::vector<size_t> _nextSetSlots;
+  // Number of the setProps call that last read each slot
+  std::vector<size_t> _slotReads;
+  size_t _readCount = 0;
+  bool _hasMutableValues = false;
+  const char *_type;
 };
 
 } // namespace RNSkia
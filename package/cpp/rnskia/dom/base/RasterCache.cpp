@@ -0,0 +1,80 @@
+#include "RasterCache.h"
+
+#include <utility>
+
+namespace RNSkia {
+
+sk_sp<SkImage> RasterCacheEntry::getImage(RasterCache *cache) {
+  if (_slot == nullptr || _slot->cache != cache) {
+    return nullptr;
+  }
+  return cache->get(_slot.get());
+}
+
+void RasterCacheEntry::setImage(RasterCache *cache, sk_sp<SkImage> image) {
+  // Released first so that the cache can purge the previous image
+  _slot = nullptr;
+  if (image != nullptr) {
+    _slot = cache->add(std::move(image));
+  }
+}
+
+RasterCache::~RasterCache() {
+  // Entries may outlive the cache, detach them from it
+  for (auto &slot : _slots) {
+    slot->image = nullptr;
+    slot->cache = nullptr;
+  }
+}
+
+void RasterCache::setBudget(size_t bytes) {
+  _budget = bytes;
+  evict(nullptr);
+}
+
+void RasterCache::purge() {
+  for (auto it = _slots.begin(); it != _slots.end();) {
+    // Only referenced by the cache once its entry is cleared or destroyed
+    auto slot = (it++)->get();
+    if (slot->position->use_count() == 1) {
+      remove(slot);
+    }
+  }
+}
+
+sk_sp<SkImage> RasterCache::get(RasterCacheSlot *slot) {
+  _slots.splice(_slots.begin(), _slots, slot->position);
+  return slot->image;
+}
+
+std::shared_ptr<RasterCacheSlot> RasterCache::add(sk_sp<SkImage> image) {
+  purge();
+  auto slot = std::make_shared<RasterCacheSlot>();
+  slot->bytes = image->imageInfo().computeMinByteSize();
+  slot->image = std::move(image);
+  slot->cache = this;
+  slot->position = _slots.insert(_slots.begin(), slot);
+  _usedBytes += slot->bytes;
+  evict(slot.get());
+  return slot;
+}
+
+void RasterCache::remove(RasterCacheSlot *slot) {
+  _usedBytes -= slot->bytes;
+  slot->image = nullptr;
+  slot->bytes = 0;
+  slot->cache = nullptr;
+  // Erased last, since the list may hold the last reference to the slot
+  _slots.erase(slot->position);
+}
+
+void RasterCache::evict(const RasterCacheSlot *keep) {
+  // The image just added is kept even if it alone is over budget, it is
+  // evicted when the next image is added.
+  while (_usedBytes > _budget && !_slots.empty() &&
+         _slots.back().get() != keep) {
+    remove(_slots.back().get());
+  }
+}
+
+} // namespace RNSkia
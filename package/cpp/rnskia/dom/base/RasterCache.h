@@ -0,0 +1,110 @@
+#pragma once
+
+#include <list>
+#include <memory>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkImage.h"
+#include "SkMatrix.h"
+#include "SkRect.h"
+#include "SkRefCnt.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+class RasterCache;
+
+/**
+ Image held by a RasterCache for an entry
+ */
+struct RasterCacheSlot {
+  sk_sp<SkImage> image;
+  size_t bytes = 0;
+  // Cache holding the image, null once the image is evicted
+  RasterCache *cache = nullptr;
+  std::list<std::shared_ptr<RasterCacheSlot>>::iterator position;
+};
+
+/**
+ Image of a rasterized node subtree together with the state it was rendered
+ with. Entries are owned by their node, while their images are owned by the
+ RasterCache of the renderer that drew them. Entries can be released on any
+ thread, the image is then released by the cache on its render thread.
+ */
+class RasterCacheEntry {
+public:
+  /**
+   Returns the image and marks it as recently used, or null if the image has
+   been evicted, never set, or set by another cache
+   */
+  sk_sp<SkImage> getImage(RasterCache *cache);
+
+  /**
+   Sets the image, evicting the least recently used images of the cache if
+   needed
+   */
+  void setImage(RasterCache *cache, sk_sp<SkImage> image);
+
+  /**
+   Releases the image
+   */
+  void clear() { _slot = nullptr; }
+
+  // State the image was rendered with
+  size_t version = 0;
+  size_t parentPaintVersion = 0;
+  SkMatrix matrix;
+  SkIRect deviceBounds = SkIRect::MakeEmpty();
+
+private:
+  std::shared_ptr<RasterCacheSlot> _slot;
+};
+
+/**
+ Keeps the total size of the rasterized node images of a renderer within a
+ memory budget by releasing the least recently used images. Only used on the
+ render thread of its renderer, so images are released on the thread owning
+ their GPU context.
+ */
+class RasterCache {
+public:
+  static constexpr size_t DefaultBudgetBytes = 64 * 1024 * 1024;
+
+  RasterCache() = default;
+  RasterCache(const RasterCache &) = delete;
+  RasterCache &operator=(const RasterCache &) = delete;
+  ~RasterCache();
+
+  /**
+   Sets the memory budget in bytes, evicting images if needed
+   */
+  void setBudget(size_t bytes);
+
+  /**
+   Returns the number of bytes used by the cached images
+   */
+  size_t getUsedBytes() { return _usedBytes; }
+
+  /**
+   Releases the images of entries that have been cleared or destroyed
+   */
+  void purge();
+
+private:
+  friend class RasterCacheEntry;
+
+  sk_sp<SkImage> get(RasterCacheSlot *slot);
+  std::shared_ptr<RasterCacheSlot> add(sk_sp<SkImage> image);
+  void remove(RasterCacheSlot *slot);
+  void evict(const RasterCacheSlot *keep);
+
+  // Most recently used first
+  std::list<std::shared_ptr<RasterCacheSlot>> _slots;
+  size_t _usedBytes = 0;
+  size_t _budget = DefaultBudgetBytes;
+};
+
+} // namespace RNSkia
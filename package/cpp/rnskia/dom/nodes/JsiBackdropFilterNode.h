@@ -13,16 +13,21 @@ public:
   explicit JsiBackdropFilterNode(std::shared_ptr<RNSkPlatformContext> context)
       : JsiDomDrawingNode(context, "skBackdropFilter") {}
 
+  /**
+   The filter is applied to everything drawn before the node
+   */
+  bool readsBackdrop() override { return true; }
+
 protected:
   void draw(DrawingContext *context) override {
     auto children = getChildren();
 
-    if (children.size() == 0) {
+    if (children.empty()) {
       return;
     }
 
     auto canvas = context->getCanvas();
-    auto firstChild = children[0];
+    auto firstChild = children.front();
     sk_sp<SkImageFilter> imageFilter;
 
     if (firstChild->getNodeClass() == NodeClass::DeclarationNode) {
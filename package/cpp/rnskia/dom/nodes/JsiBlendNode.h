@@ -51,7 +51,7 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _blendProp = container->defineProperty<BlendModeProp>("mode");
+    _blendProp = container->defineProperty<BlendModeProp>(PropNameMode);
     _blendProp->require();
   }
 
@@ -43,9 +43,9 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _style = container->defineProperty<NodeProp>("style");
-    _respectCTM = container->defineProperty<NodeProp>("respectCTM");
-    _blur = container->defineProperty<NodeProp>("blur");
+    _style = container->defineProperty<NodeProp>(PropNameStyle);
+    _respectCTM = container->defineProperty<NodeProp>(PropNameRespectCTM);
+    _blur = container->defineProperty<NodeProp>(PropNameBlur);
 
     _blur->require();
   }
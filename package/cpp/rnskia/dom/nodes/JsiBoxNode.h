@@ -26,6 +26,22 @@ protected:
         shadows.push_back(shadowNode);
       }
     }
+    // Inner shadows are clipped to the box
+    if (context->isMeasuring()) {
+      context->addLocalBounds(box.rect(), *context->getPaint(), false);
+      for (auto &shadow : shadows) {
+        if (!shadow->getBoxShadowProps()->isInner()) {
+          auto dx = shadow->getBoxShadowProps()->getDx();
+          auto dy = shadow->getBoxShadowProps()->getDy();
+          auto spread = shadow->getBoxShadowProps()->getSpread();
+          context->addLocalBounds(
+              inflate(box, spread, spread, dx, dy).rect(),
+              *shadow->getBoxShadowProps()->getDerivedValue(), false);
+        }
+      }
+      return;
+    }
+
     // Render outer shadows
     for (auto &shadow : shadows) {
       if (!shadow->getBoxShadowProps()->isInner()) {
@@ -69,7 +85,7 @@ protected:
 
   void defineProperties(NodePropsContainer *container) override {
     JsiDomRenderNode::defineProperties(container);
-    _boxProp = container->defineProperty<BoxProps>("box");
+    _boxProp = container->defineProperty<BoxProps>(PropNameBox);
     _boxProp->require();
   }
 
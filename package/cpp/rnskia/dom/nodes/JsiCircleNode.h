@@ -20,10 +20,18 @@ protected:
     context->getCanvas()->drawCircle(*circle, r, *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto circle = _circleProp->getDerivedValue();
+    auto r = _radiusProp->value().getAsNumber();
+    *bounds = SkRect::MakeLTRB(circle->x() - r, circle->y() - r,
+                               circle->x() + r, circle->y() + r);
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
     _circleProp = container->defineProperty<CircleProp>();
-    _radiusProp = container->defineProperty<NodeProp>("r");
+    _radiusProp = container->defineProperty<NodeProp>(PropNameR);
     _radiusProp->require();
   }
 
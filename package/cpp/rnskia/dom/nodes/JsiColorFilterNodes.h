@@ -56,7 +56,7 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _matrixProp = container->defineProperty<NodeProp>("matrix");
+    _matrixProp = container->defineProperty<NodeProp>(PropNameMatrix);
     _matrixProp->require();
   }
 
@@ -79,8 +79,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _blendModeProp = container->defineProperty<BlendModeProp>("mode");
-    _colorProp = container->defineProperty<ColorProp>("color");
+    _blendModeProp = container->defineProperty<BlendModeProp>(PropNameMode);
+    _colorProp = container->defineProperty<ColorProp>(PropNameColor);
 
     _blendModeProp->require();
     _colorProp->require();
@@ -153,7 +153,7 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _tProp = container->defineProperty<NodeProp>("t");
+    _tProp = container->defineProperty<NodeProp>(PropNameT);
     _tProp->require();
   }
 
@@ -18,6 +18,12 @@ public:
   explicit JsiCustomDrawingNode(std::shared_ptr<RNSkPlatformContext> context)
       : JsiDomDrawingNode(context, "skCustomDrawing") {}
 
+  /**
+   Drawing runs the drawing callback on the JS thread and requests a redraw
+   with the new picture, so the node can't be replayed from a recorded picture.
+   */
+  bool hasVolatileContent() override { return true; }
+
 protected:
   void draw(DrawingContext *context) override {
     if (_drawing != nullptr) {
@@ -104,7 +110,7 @@ protected:
         std::bind(&JsiCustomDrawingNode::notifyPictureNeeded, this,
                   std::placeholders::_1);
 
-    _drawingProp = container->defineProperty<DrawingProp>("drawing", cb);
+    _drawingProp = container->defineProperty<DrawingProp>(PropNameDrawing, cb);
   }
 
 private:
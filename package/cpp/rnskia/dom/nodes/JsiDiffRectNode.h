@@ -20,10 +20,15 @@ protected:
                                      *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    *bounds = _outerRectProp->getDerivedValue()->getBounds();
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _innerRectProp = container->defineProperty<RRectProp>("inner");
-    _outerRectProp = container->defineProperty<RRectProp>("outer");
+    _innerRectProp = container->defineProperty<RRectProp>(PropNameInner);
+    _outerRectProp = container->defineProperty<RRectProp>(PropNameOuter);
 
     _innerRectProp->require();
     _outerRectProp->require();
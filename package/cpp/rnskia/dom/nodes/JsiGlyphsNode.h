@@ -6,6 +6,7 @@
 #include "GlyphsProp.h"
 
 #include <memory>
+#include <vector>
 
 namespace RNSkia {
 
@@ -28,13 +29,30 @@ protected:
         SkPoint::Make(x, y), *font, *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto font = _fontProp->getDerivedValue();
+    auto glyphInfo = _glyphsProp->getDerivedValue();
+    auto count = static_cast<int>(glyphInfo->glyphIds.size());
+    std::vector<SkRect> glyphBounds(count);
+    font->getBounds(glyphInfo->glyphIds.data(), count, glyphBounds.data(),
+                    nullptr);
+    bounds->setEmpty();
+    for (int i = 0; i < count; ++i) {
+      bounds->join(glyphBounds[i].makeOffset(glyphInfo->positions[i].x(),
+                                             glyphInfo->positions[i].y()));
+    }
+    bounds->offset(_xProp->value().getAsNumber(),
+                   _yProp->value().getAsNumber());
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
 
-    _fontProp = container->defineProperty<FontProp>("font");
-    _glyphsProp = container->defineProperty<GlyphsProp>("glyphs");
-    _xProp = container->defineProperty<NodeProp>("x");
-    _yProp = container->defineProperty<NodeProp>("y");
+    _fontProp = container->defineProperty<FontProp>(PropNameFont);
+    _glyphsProp = container->defineProperty<GlyphsProp>(PropNameGlyphs);
+    _xProp = container->defineProperty<NodeProp>(PropNameX);
+    _yProp = container->defineProperty<NodeProp>(PropNameY);
 
     _fontProp->require();
     _glyphsProp->require();
@@ -20,6 +20,12 @@ public:
       }
     }
   }
+
+protected:
+  void defineProperties(NodePropsContainer *container) override {
+    JsiDomRenderNode::defineProperties(container);
+    _rasterizeProp = container->defineProperty<NodeProp>(PropNameRasterize);
+  }
 };
 
 } // namespace RNSkia
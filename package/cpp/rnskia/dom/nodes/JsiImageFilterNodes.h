@@ -69,7 +69,7 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _blendModeProp = container->defineProperty<BlendModeProp>("mode");
+    _blendModeProp = container->defineProperty<BlendModeProp>(PropNameMode);
     _blendModeProp->require();
   }
 
@@ -129,13 +129,13 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _dxProp = container->defineProperty<NodeProp>("dx");
-    _dyProp = container->defineProperty<NodeProp>("dy");
-    _blurProp = container->defineProperty<NodeProp>("blur");
-    _colorProp = container->defineProperty<ColorProp>("color");
+    _dxProp = container->defineProperty<NodeProp>(PropNameDx);
+    _dyProp = container->defineProperty<NodeProp>(PropNameDy);
+    _blurProp = container->defineProperty<NodeProp>(PropNameBlur);
+    _colorProp = container->defineProperty<ColorProp>(PropNameColor);
 
-    _innerProp = container->defineProperty<NodeProp>("inner");
-    _shadowOnlyProp = container->defineProperty<NodeProp>("shadowOnly");
+    _innerProp = container->defineProperty<NodeProp>(PropNameInner);
+    _shadowOnlyProp = container->defineProperty<NodeProp>(PropNameShadowOnly);
 
     _dxProp->require();
     _dyProp->require();
@@ -181,9 +181,9 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _channelXProp = container->defineProperty<NodeProp>("channelX");
-    _channelYProp = container->defineProperty<NodeProp>("channelY");
-    _scaleProp = container->defineProperty<NodeProp>("scale");
+    _channelXProp = container->defineProperty<NodeProp>(PropNameChannelX);
+    _channelYProp = container->defineProperty<NodeProp>(PropNameChannelY);
+    _scaleProp = container->defineProperty<NodeProp>(PropNameScale);
 
     _channelXProp->require();
     _channelYProp->require();
@@ -229,8 +229,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _blurProp = container->defineProperty<RadiusProp>("blur");
-    _tileModeProp = container->defineProperty<TileModeProp>("mode");
+    _blurProp = container->defineProperty<RadiusProp>(PropNameBlur);
+    _tileModeProp = container->defineProperty<TileModeProp>(PropNameMode);
 
     _blurProp->require();
   }
@@ -260,8 +260,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _xProp = container->defineProperty<NodeProp>("x");
-    _yProp = container->defineProperty<NodeProp>("y");
+    _xProp = container->defineProperty<NodeProp>(PropNameX);
+    _yProp = container->defineProperty<NodeProp>(PropNameY);
 
     _xProp->require();
     _yProp->require();
@@ -299,8 +299,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _operatorProp = container->defineProperty<NodeProp>("operator");
-    _radiusProp = container->defineProperty<RadiusProp>("radius");
+    _operatorProp = container->defineProperty<NodeProp>(PropNameOperator);
+    _radiusProp = container->defineProperty<RadiusProp>(PropNameRadius);
 
     _operatorProp->require();
     _radiusProp->require();
@@ -346,9 +346,9 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _sourceProp = container->defineProperty<NodeProp>("source");
+    _sourceProp = container->defineProperty<NodeProp>(PropNameSource);
     _uniformsProp =
-        container->defineProperty<UniformsProp>("uniforms", _sourceProp);
+        container->defineProperty<UniformsProp>(PropNameUniforms, _sourceProp);
 
     _sourceProp->require();
   }
@@ -19,7 +19,12 @@ protected:
 
     context->getCanvas()->drawImageRect(
         _imageProps->getImage(), rects->src, rects->dst, SkSamplingOptions(),
-        context->getPaint().get(), SkCanvas::kStrict_SrcRectConstraint);
+        context->getPaint(), SkCanvas::kStrict_SrcRectConstraint);
+  }
+
+  bool computeBounds(SkRect *bounds) override {
+    *bounds = _imageProps->getDerivedValue()->dst.makeSorted();
+    return true;
   }
 
   void defineProperties(NodePropsContainer *container) override {
@@ -28,8 +28,8 @@ protected:
 
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _svgDomProp = container->defineProperty<SvgProp>("svg");
-    _rectProp = container->defineProperty<RectProps>("rect");
+    _svgDomProp = container->defineProperty<SvgProp>(PropNameSvg);
+    _rectProp = container->defineProperty<RectProps>(PropNameRect);
 
     _svgDomProp->require();
   }
@@ -19,27 +19,24 @@ protected:
   void renderNode(DrawingContext *context) override {
 
     auto hasLayer = false;
-    auto children = getChildren();
+    auto isFirst = true;
 
     // Is the first children a layer?
-    for (size_t i = 0; i < children.size(); ++i) {
-      if (i == 0) {
+    for (auto &child : getChildren()) {
+      if (isFirst) {
+        isFirst = false;
         // Check for paint node as layer
-        if (children.at(i)->getNodeClass() == NodeClass::DeclarationNode) {
+        if (child->getNodeClass() == NodeClass::DeclarationNode) {
           auto declarationNode =
-              std::static_pointer_cast<JsiDomDeclarationNode>(children.at(i));
+              std::static_pointer_cast<JsiDomDeclarationNode>(child);
 
           if (declarationNode->getDeclarationType() == DeclarationType::Paint) {
             // Yes, it is a paint node - which we can use as a layer.
             auto declarationContext = context->getDeclarationContext();
-            auto layerNode =
-                std::static_pointer_cast<JsiDomDeclarationNode>(children.at(i));
+            auto layerNode = std::static_pointer_cast<JsiPaintNode>(child);
 
             // Save canvas with the paint node's paint!
-            declarationContext->save();
-            layerNode->decorate(declarationContext);
-            auto paint = declarationContext->getPaints()->pop();
-            declarationContext->restore();
+            auto &paint = layerNode->getPaint(declarationContext);
 
             if (paint) {
               hasLayer = true;
@@ -53,9 +50,8 @@ protected:
       }
 
       // Render rest of the children
-      if (children.at(i)->getNodeClass() == NodeClass::RenderNode) {
-        std::static_pointer_cast<JsiDomRenderNode>(children.at(i))
-            ->render(context);
+      if (child->getNodeClass() == NodeClass::RenderNode) {
+        std::static_pointer_cast<JsiDomRenderNode>(child)->render(context);
       }
     }
 
@@ -68,6 +64,28 @@ protected:
     JsiDomRenderNode::defineProperties(container);
   }
 
+  /**
+   The paint node first among the children is the layer
+   */
+  bool hasUnboundedLayer(DrawingContext *context) override {
+    if (JsiDomRenderNode::hasUnboundedLayer(context)) {
+      return true;
+    }
+    auto children = getChildren();
+    if (children.empty()) {
+      return false;
+    }
+    auto &firstChild = children.front();
+    if (firstChild->getNodeClass() != NodeClass::DeclarationNode ||
+        std::static_pointer_cast<JsiDomDeclarationNode>(firstChild)
+                ->getDeclarationType() != DeclarationType::Paint) {
+      return false;
+    }
+    auto &paint = std::static_pointer_cast<JsiPaintNode>(firstChild)->getPaint(
+        context->getDeclarationContext());
+    return paint != nullptr && isUnboundedLayerPaint(*paint);
+  }
+
 private:
 };
 
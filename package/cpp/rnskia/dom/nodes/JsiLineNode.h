@@ -21,10 +21,18 @@ protected:
         *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    SkPoint points[2] = {*_p1Prop->getDerivedValue(),
+                         *_p2Prop->getDerivedValue()};
+    return bounds->setBoundsCheck(points, 2);
+  }
+
+  bool isAlwaysStroked() override { return true; }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _p1Prop = container->defineProperty<PointProp>("p1");
-    _p2Prop = container->defineProperty<PointProp>("p2");
+    _p1Prop = container->defineProperty<PointProp>(PropNameP1);
+    _p2Prop = container->defineProperty<PointProp>(PropNameP2);
 
     _p1Prop->require();
     _p2Prop->require();
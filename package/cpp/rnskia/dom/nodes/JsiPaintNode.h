@@ -14,7 +14,41 @@ public:
       : JsiDomDeclarationNode(context, "skPaint", DeclarationType::Paint) {}
 
   void decorate(DeclarationContext *context) override {
-    auto paint = std::make_shared<SkPaint>();
+    context->getPaints()->push(getPaint(context));
+  }
+
+  /**
+   Returns the paint made from the props and declarations of the node. The
+   paint is rebuilt in place when they change and shared otherwise.
+   */
+  const std::shared_ptr<SkPaint> &getPaint(DeclarationContext *context) {
+    if (consumeInvalidations(InvalidatesPaint) || _paint == nullptr) {
+      if (_paint == nullptr) {
+        _paint = std::make_shared<SkPaint>();
+      }
+      buildPaint(context, _paint.get());
+      _paintVersion = DrawingContext::nextPaintVersion();
+    }
+    return _paint;
+  }
+
+  /**
+   Returns the version of the paint, which changes each time it is rebuilt
+   */
+  size_t getPaintVersion() { return _paintVersion; }
+
+protected:
+  void defineProperties(NodePropsContainer *container) override {
+    JsiDomDeclarationNode::defineProperties(container);
+
+    _paintProps = container->defineProperty<PaintProps>();
+  }
+
+private:
+  void buildPaint(DeclarationContext *context, SkPaint *paint) {
+    // Paints replace the paint of the node drawing them rather than inherit
+    // from it, and are anti aliased like the root paint unless set otherwise
+    *paint = SkPaint();
     paint->setAntiAlias(true);
 
     if (_paintProps->getOpacity()->isSet()) {
@@ -97,19 +131,12 @@ public:
     if (pathEffect) {
       paint->setPathEffect(pathEffect);
     }
-
-    context->getPaints()->push(paint);
-  }
-
-protected:
-  void defineProperties(NodePropsContainer *container) override {
-    JsiDomDeclarationNode::defineProperties(container);
-
-    _paintProps = container->defineProperty<PaintProps>();
   }
 
-private:
   PaintProps *_paintProps;
+
+  std::shared_ptr<SkPaint> _paint;
+  size_t _paintVersion = 0;
 };
 
 } // namespace RNSkia
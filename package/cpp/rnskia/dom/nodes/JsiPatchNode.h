@@ -32,10 +32,11 @@ protected:
 
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _colorsProp = container->defineProperty<ColorsProp>("colors");
-    _textureProp = container->defineProperty<PointsProp>("texture");
-    _blendModeProp = container->defineProperty<BlendModeProp>("blendMode");
-    _patchProp = container->defineProperty<BezierProp>("patch");
+    _colorsProp = container->defineProperty<ColorsProp>(PropNameColors);
+    _textureProp = container->defineProperty<PointsProp>(PropNameTexture);
+    _blendModeProp =
+        container->defineProperty<BlendModeProp>(PropNameBlendMode);
+    _patchProp = container->defineProperty<BezierProp>(PropNamePatch);
 
     _patchProp->require();
   }
@@ -63,8 +63,8 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _intervals = container->defineProperty<NodeProp>("intervals");
-    _phase = container->defineProperty<NodeProp>("phase");
+    _intervals = container->defineProperty<NodeProp>(PropNameIntervals);
+    _phase = container->defineProperty<NodeProp>(PropNamePhase);
 
     _intervals->require();
   }
@@ -96,9 +96,9 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _lengthProp = container->defineProperty<NodeProp>("length");
-    _deviationProp = container->defineProperty<NodeProp>("deviation");
-    _seedProp = container->defineProperty<NodeProp>("seed");
+    _lengthProp = container->defineProperty<NodeProp>(PropNameLength);
+    _deviationProp = container->defineProperty<NodeProp>(PropNameDeviation);
+    _seedProp = container->defineProperty<NodeProp>(PropNameSeed);
 
     _lengthProp->require();
     _deviationProp->require();
@@ -128,7 +128,7 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _rProp = container->defineProperty<NodeProp>("r");
+    _rProp = container->defineProperty<NodeProp>(PropNameR);
     _rProp->require();
   }
 
@@ -156,10 +156,10 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _phaseProp = container->defineProperty<NodeProp>("phase");
-    _advanceProp = container->defineProperty<NodeProp>("advance");
-    _pathProp = container->defineProperty<PathProp>("path");
-    _styleProp = container->defineProperty<NodeProp>("style");
+    _phaseProp = container->defineProperty<NodeProp>(PropNamePhase);
+    _advanceProp = container->defineProperty<NodeProp>(PropNameAdvance);
+    _pathProp = container->defineProperty<PathProp>(PropNamePath);
+    _styleProp = container->defineProperty<NodeProp>(PropNameStyle);
 
     _phaseProp->require();
     _advanceProp->require();
@@ -205,8 +205,8 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _matrixProp = container->defineProperty<MatrixProp>("matrix");
-    _pathProp = container->defineProperty<PathProp>("path");
+    _matrixProp = container->defineProperty<MatrixProp>(PropNameMatrix);
+    _pathProp = container->defineProperty<PathProp>(PropNamePath);
 
     _matrixProp->require();
     _pathProp->require();
@@ -236,8 +236,8 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
 
-    _matrixProp = container->defineProperty<MatrixProp>("matrix");
-    _widthProp = container->defineProperty<NodeProp>("width");
+    _matrixProp = container->defineProperty<MatrixProp>(PropNameMatrix);
+    _widthProp = container->defineProperty<NodeProp>(PropNameWidth);
 
     _matrixProp->require();
     _widthProp->require();
@@ -15,9 +15,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameMiterLimit = JsiPropId::get("miter_limit");
-static PropId PropNamePrecision = JsiPropId::get("precision");
-
 class JsiPathNode : public JsiDomDrawingNode,
                     public JsiDomNodeCtor<JsiPathNode> {
 public:
@@ -26,7 +23,44 @@ public:
 
 protected:
   void draw(DrawingContext *context) override {
-    if (getPropsContainer()->isChanged()) {
+    resolvePath();
+
+    if (_path == nullptr) {
+      throw std::runtime_error(
+          "Path node could not resolve path props correctly.");
+    }
+
+    context->getCanvas()->drawPath(*_path, *context->getPaint());
+  }
+
+  bool computeBounds(SkRect *bounds) override {
+    resolvePath();
+
+    // Inverse fills cover everything outside of the path
+    if (_path == nullptr || _path->isInverseFillType()) {
+      return false;
+    }
+    *bounds = _path->getBounds();
+    return true;
+  }
+
+  void defineProperties(NodePropsContainer *container) override {
+    JsiDomDrawingNode::defineProperties(container);
+    _pathProp = container->defineProperty<PathProp>(PropNamePath);
+    _startProp = container->defineProperty<NodeProp>(PropNameStart);
+    _endProp = container->defineProperty<NodeProp>(PropNameEnd);
+    _fillTypeProp = container->defineProperty<NodeProp>(PropNameFillType);
+    _strokeOptsProp = container->defineProperty<NodeProp>(PropNameStroke);
+
+    _pathProp->require();
+  }
+
+private:
+  /**
+   Updates the path to draw from the path props when they have changed
+   */
+  void resolvePath() {
+    if (consumeInvalidations(InvalidatesGeometry)) {
       // Can we use the path directly, or do we need to copy to
       // mutate / modify the path?
       auto hasStartOffset =
@@ -82,14 +116,14 @@ protected:
           auto opts = _strokeOptsProp->value();
           SkPaint strokePaint;
 
-          if (opts.hasValue(JsiPropId::get("strokeCap"))) {
+          if (opts.hasValue(PropNameStrokeCap)) {
             strokePaint.setStrokeCap(StrokeCapProp::getCapFromString(
-                opts.getValue(JsiPropId::get("strokeCap")).getAsString()));
+                opts.getValue(PropNameStrokeCap).getAsString()));
           }
 
-          if (opts.hasValue(JsiPropId::get("strokeJoin"))) {
+          if (opts.hasValue(PropNameStrokeJoin)) {
             strokePaint.setStrokeJoin(StrokeJoinProp::getJoinFromString(
-                opts.getValue(JsiPropId::get("strokeJoin")).getAsString()));
+                opts.getValue(PropNameStrokeJoin).getAsString()));
           }
 
           if (opts.hasValue(PropNameWidth)) {
@@ -123,27 +157,8 @@ protected:
         _path = _pathProp->getDerivedValue();
       }
     }
-
-    if (_path == nullptr) {
-      throw std::runtime_error(
-          "Path node could not resolve path props correctly.");
-    }
-
-    context->getCanvas()->drawPath(*_path, *context->getPaint());
-  }
-
-  void defineProperties(NodePropsContainer *container) override {
-    JsiDomDrawingNode::defineProperties(container);
-    _pathProp = container->defineProperty<PathProp>("path");
-    _startProp = container->defineProperty<NodeProp>("start");
-    _endProp = container->defineProperty<NodeProp>("end");
-    _fillTypeProp = container->defineProperty<NodeProp>("fillType");
-    _strokeOptsProp = container->defineProperty<NodeProp>("stroke");
-
-    _pathProp->require();
   }
 
-private:
   SkPathFillType getFillTypeFromStringValue(const std::string &value) {
     if (value == "winding") {
       return SkPathFillType::kWinding;
@@ -171,7 +186,7 @@ class StrokeOptsProps : public BaseDerivedProp {
 public:
   explicit StrokeOptsProps(const std::function<void(BaseNodeProp *)> &onChange)
       : BaseDerivedProp(onChange) {
-    _strokeProp = defineProperty<NodeProp>("stroke");
+    _strokeProp = defineProperty<NodeProp>(PropNameStroke);
   }
 
 private:
@@ -20,7 +20,7 @@ protected:
 
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _pictureProp = container->defineProperty<PictureProp>("picture");
+    _pictureProp = container->defineProperty<PictureProp>(PropNamePicture);
     _pictureProp->require();
   }
 
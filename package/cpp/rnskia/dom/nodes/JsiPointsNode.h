@@ -14,8 +14,6 @@
 
 namespace RNSkia {
 
-static PropId PropNamePointsMode = JsiPropId::get("mode");
-
 class JsiPointsNode : public JsiDomDrawingNode,
                       public JsiDomNodeCtor<JsiPointsNode> {
 public:
@@ -31,10 +29,18 @@ protected:
                                      *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto points = _pointsProp->getDerivedValue();
+    return bounds->setBoundsCheck(points->data(),
+                                  static_cast<int>(points->size()));
+  }
+
+  bool isAlwaysStroked() override { return true; }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
-    _pointModeProp = container->defineProperty<PointModeProp>("mode");
-    _pointsProp = container->defineProperty<PointsProp>("points");
+    _pointModeProp = container->defineProperty<PointModeProp>(PropNameMode);
+    _pointsProp = container->defineProperty<PointsProp>(PropNamePoints);
 
     _pointsProp->require();
     _pointModeProp->require();
@@ -19,10 +19,15 @@ protected:
                                     *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    *bounds = _rrectProp->getDerivedValue()->getBounds();
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
 
-    _rrectProp = container->defineProperty<RRectProps>("rect");
+    _rrectProp = container->defineProperty<RRectProps>(PropNameRect);
     _rrectProp->require();
   }
 
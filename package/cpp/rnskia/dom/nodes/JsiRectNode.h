@@ -19,10 +19,15 @@ protected:
                                    *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    *bounds = _rectProp->getDerivedValue()->makeSorted();
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
 
-    _rectProp = container->defineProperty<RectProps>("rect");
+    _rectProp = container->defineProperty<RectProps>(PropNameRect);
     _rectProp->require();
   }
 
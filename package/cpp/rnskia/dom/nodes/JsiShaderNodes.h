@@ -65,11 +65,12 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _sourceProp = container->defineProperty<NodeProp>("source");
+    _sourceProp = container->defineProperty<NodeProp>(PropNameSource);
     _uniformsProp =
-        container->defineProperty<UniformsProp>("uniforms", _sourceProp);
-    _transformProp = container->defineProperty<TransformProp>("transform");
-    _originProp = container->defineProperty<PointProp>("origin");
+        container->defineProperty<UniformsProp>(PropNameUniforms, _sourceProp);
+    _transformProp =
+        container->defineProperty<TransformProp>(PropNameTransform);
+    _originProp = container->defineProperty<PointProp>(PropNameOrigin);
 
     _sourceProp->require();
   }
@@ -95,24 +96,21 @@ public:
     auto lm =
         _transformProp->isSet() ? _transformProp->getDerivedValue() : nullptr;
 
+    // The shader is only made again when the props changed. To modify the
+    // matrix we need to copy it since we're not allowed to modify values
+    // contained in properties.
+    _matrix.reset();
     if (rect != nullptr && lm != nullptr) {
       auto rc = _imageProps->getDerivedValue();
       auto m3 = _imageProps->rect2rect(rc->src, rc->dst);
-      if (_transformProp->isChanged()) {
-        // To modify the matrix we need to copy it since we're not allowed to
-        // modify values contained in properties - this would have caused the
-        // matrix to be translated and scaled more and more for each render
-        // even thought the matrix prop did not change.
-        _matrix.reset();
-        _matrix.preConcat(m3);
-        if (_originProp->isSet()) {
-          auto tr = _originProp->getDerivedValue();
-          _matrix.preTranslate(tr->x(), tr->y());
-          _matrix.preConcat(*lm);
-          _matrix.preTranslate(-tr->x(), -tr->y());
-        } else {
-          _matrix.preConcat(*lm);
-        }
+      _matrix.preConcat(m3);
+      if (_originProp->isSet()) {
+        auto tr = _originProp->getDerivedValue();
+        _matrix.preTranslate(tr->x(), tr->y());
+        _matrix.preConcat(*lm);
+        _matrix.preTranslate(-tr->x(), -tr->y());
+      } else {
+        _matrix.preConcat(*lm);
       }
     }
 
@@ -127,14 +125,15 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _txProp = container->defineProperty<TileModeProp>("tx");
-    _tyProp = container->defineProperty<TileModeProp>("ty");
-    _filterModeProp = container->defineProperty<NodeProp>("fm");
-    _mipmapModeProp = container->defineProperty<NodeProp>("mm");
+    _txProp = container->defineProperty<TileModeProp>(PropNameTx);
+    _tyProp = container->defineProperty<TileModeProp>(PropNameTy);
+    _filterModeProp = container->defineProperty<NodeProp>(PropNameFm);
+    _mipmapModeProp = container->defineProperty<NodeProp>(PropNameMm);
 
     _imageProps = container->defineProperty<ImageProps>();
-    _transformProp = container->defineProperty<TransformProp>("transform");
-    _originProp = container->defineProperty<PointProp>("origin");
+    _transformProp =
+        container->defineProperty<TransformProp>(PropNameTransform);
+    _originProp = container->defineProperty<PointProp>(PropNameOrigin);
 
     _txProp->require();
     _tyProp->require();
@@ -144,7 +143,7 @@ protected:
     _transformProp->require();
 
     // Add and require the image
-    container->defineProperty<NodeProp>("image")->require();
+    container->defineProperty<NodeProp>(PropNameImage)->require();
   }
 
 private:
@@ -202,7 +201,7 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _colorProp = container->defineProperty<ColorProp>("color");
+    _colorProp = container->defineProperty<ColorProp>(PropNameColor);
     _colorProp->require();
   }
 
@@ -213,17 +212,17 @@ private:
 class JsiBasePerlinNoiseNode : public JsiDomDeclarationNode {
 public:
   JsiBasePerlinNoiseNode(std::shared_ptr<RNSkPlatformContext> context,
-                         PropId type)
+                         const char *type)
       : JsiDomDeclarationNode(context, type, DeclarationType::Shader) {}
 
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDeclarationNode::defineProperties(container);
-    _freqXProp = container->defineProperty<NodeProp>("freqX");
-    _freqYProp = container->defineProperty<NodeProp>("freqY");
-    _octavesProp = container->defineProperty<NodeProp>("octaves");
-    _seedProp = container->defineProperty<NodeProp>("seed");
-    _tileWidthProp = container->defineProperty<NodeProp>("tileWidth");
-    _tileHeightProp = container->defineProperty<NodeProp>("tileHeight");
+    _freqXProp = container->defineProperty<NodeProp>(PropNameFreqX);
+    _freqYProp = container->defineProperty<NodeProp>(PropNameFreqY);
+    _octavesProp = container->defineProperty<NodeProp>(PropNameOctaves);
+    _seedProp = container->defineProperty<NodeProp>(PropNameSeed);
+    _tileWidthProp = container->defineProperty<NodeProp>(PropNameTileWidth);
+    _tileHeightProp = container->defineProperty<NodeProp>(PropNameTileHeight);
 
     _freqXProp->require();
     _freqYProp->require();
@@ -279,7 +278,8 @@ public:
 
 class JsiBaseGradientNode : public JsiDomDeclarationNode {
 public:
-  JsiBaseGradientNode(std::shared_ptr<RNSkPlatformContext> context, PropId type)
+  JsiBaseGradientNode(std::shared_ptr<RNSkPlatformContext> context,
+                      const char *type)
       : JsiDomDeclarationNode(context, type, DeclarationType::Shader) {}
 
   void decorate(DeclarationContext *context) override {
@@ -302,10 +302,10 @@ protected:
     JsiDomDeclarationNode::defineProperties(container);
     _transformsProps = container->defineProperty<TransformsProps>();
 
-    _colorsProp = container->defineProperty<ColorsProp>("colors");
-    _positionsProp = container->defineProperty<NumbersProp>("positions");
-    _modeProp = container->defineProperty<TileModeProp>("mode");
-    _flagsProp = container->defineProperty<NodeProp>("flags");
+    _colorsProp = container->defineProperty<ColorsProp>(PropNameColors);
+    _positionsProp = container->defineProperty<NumbersProp>(PropNamePositions);
+    _modeProp = container->defineProperty<TileModeProp>(PropNameMode);
+    _flagsProp = container->defineProperty<NodeProp>(PropNameFlags);
 
     _colorsProp->require();
   }
@@ -344,8 +344,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiBaseGradientNode::defineProperties(container);
-    _startProp = container->defineProperty<PointProp>("start");
-    _endProp = container->defineProperty<PointProp>("end");
+    _startProp = container->defineProperty<PointProp>(PropNameStart);
+    _endProp = container->defineProperty<PointProp>(PropNameEnd);
 
     _startProp->require();
     _endProp->require();
@@ -375,8 +375,8 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiBaseGradientNode::defineProperties(container);
-    _centerProp = container->defineProperty<PointProp>("c");
-    _radiusProp = container->defineProperty<NodeProp>("r");
+    _centerProp = container->defineProperty<PointProp>(PropNameC);
+    _radiusProp = container->defineProperty<NodeProp>(PropNameR);
 
     _centerProp->require();
     _radiusProp->require();
@@ -408,9 +408,9 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiBaseGradientNode::defineProperties(container);
-    _startProp = container->defineProperty<NodeProp>("start");
-    _endProp = container->defineProperty<NodeProp>("end");
-    _centerProp = container->defineProperty<PointProp>("c");
+    _startProp = container->defineProperty<NodeProp>(PropNameStart);
+    _endProp = container->defineProperty<NodeProp>(PropNameEnd);
+    _centerProp = container->defineProperty<PointProp>(PropNameC);
   }
 
 private:
@@ -443,10 +443,10 @@ public:
 protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiBaseGradientNode::defineProperties(container);
-    _startProp = container->defineProperty<PointProp>("start");
-    _startRProp = container->defineProperty<NodeProp>("startR");
-    _endProp = container->defineProperty<PointProp>("end");
-    _endRProp = container->defineProperty<NodeProp>("endR");
+    _startProp = container->defineProperty<PointProp>(PropNameStart);
+    _startRProp = container->defineProperty<NodeProp>(PropNameStartR);
+    _endProp = container->defineProperty<PointProp>(PropNameEnd);
+    _endRProp = container->defineProperty<NodeProp>(PropNameEndR);
   }
 
 private:
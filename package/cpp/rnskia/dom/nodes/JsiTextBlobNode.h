@@ -23,12 +23,22 @@ protected:
     context->getCanvas()->drawTextBlob(blob, x, y, *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto blob = _textBlobProp->getDerivedValue();
+    if (blob == nullptr) {
+      return false;
+    }
+    *bounds = blob->bounds().makeOffset(_xProp->value().getAsNumber(),
+                                        _yProp->value().getAsNumber());
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
 
-    _textBlobProp = container->defineProperty<TextBlobProp>("blob");
-    _xProp = container->defineProperty<NodeProp>("x");
-    _yProp = container->defineProperty<NodeProp>("y");
+    _textBlobProp = container->defineProperty<TextBlobProp>(PropNameBlob);
+    _xProp = container->defineProperty<NodeProp>(PropNameX);
+    _yProp = container->defineProperty<NodeProp>(PropNameY);
 
     _textBlobProp->require();
     _xProp->require();
@@ -26,13 +26,22 @@ protected:
                                          *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto &text = _textProp->value().getAsString();
+    _fontProp->getDerivedValue()->measureText(
+        text.c_str(), text.size(), SkTextEncoding::kUTF8, bounds);
+    bounds->offset(_xProp->value().getAsNumber(),
+                   _yProp->value().getAsNumber());
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
 
-    _fontProp = container->defineProperty<FontProp>("font");
-    _textProp = container->defineProperty<NodeProp>("text");
-    _xProp = container->defineProperty<NodeProp>("x");
-    _yProp = container->defineProperty<NodeProp>("y");
+    _fontProp = container->defineProperty<FontProp>(PropNameFont);
+    _textProp = container->defineProperty<NodeProp>(PropNameText);
+    _xProp = container->defineProperty<NodeProp>(PropNameX);
+    _yProp = container->defineProperty<NodeProp>(PropNameY);
 
     _fontProp->require();
     _textProp->require();
@@ -19,6 +19,15 @@ protected:
     context->getCanvas()->drawTextBlob(blob, 0, 0, *context->getPaint());
   }
 
+  bool computeBounds(SkRect *bounds) override {
+    auto blob = _textBlobProp->getDerivedValue();
+    if (blob == nullptr) {
+      return false;
+    }
+    *bounds = blob->bounds();
+    return true;
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
     _textBlobProp = container->defineProperty<TextPathBlobProp>();
@@ -30,7 +30,8 @@ protected:
   void defineProperties(NodePropsContainer *container) override {
     JsiDomDrawingNode::defineProperties(container);
     _verticesProps = container->defineProperty<VerticesProps>();
-    _blendModeProp = container->defineProperty<BlendModeProp>("blendMode");
+    _blendModeProp =
+        container->defineProperty<BlendModeProp>(PropNameBlendMode);
   }
 
 private:
@@ -29,30 +29,18 @@ public:
       std::vector<SkPoint> points;
       points.reserve(12);
 
-      points.push_back(
-          PointProp::processValue(arr[0].getValue(JsiPropId::get("pos"))));
-      points.push_back(
-          PointProp::processValue(arr[0].getValue(JsiPropId::get("c2"))));
-      points.push_back(
-          PointProp::processValue(arr[1].getValue(JsiPropId::get("c1"))));
-      points.push_back(
-          PointProp::processValue(arr[1].getValue(JsiPropId::get("pos"))));
-      points.push_back(
-          PointProp::processValue(arr[1].getValue(JsiPropId::get("c2"))));
-      points.push_back(
-          PointProp::processValue(arr[2].getValue(JsiPropId::get("c1"))));
-      points.push_back(
-          PointProp::processValue(arr[2].getValue(JsiPropId::get("pos"))));
-      points.push_back(
-          PointProp::processValue(arr[2].getValue(JsiPropId::get("c2"))));
-      points.push_back(
-          PointProp::processValue(arr[3].getValue(JsiPropId::get("c1"))));
-      points.push_back(
-          PointProp::processValue(arr[3].getValue(JsiPropId::get("pos"))));
-      points.push_back(
-          PointProp::processValue(arr[3].getValue(JsiPropId::get("c2"))));
-      points.push_back(
-          PointProp::processValue(arr[0].getValue(JsiPropId::get("c1"))));
+      points.push_back(PointProp::processValue(arr[0].getValue(PropNamePos)));
+      points.push_back(PointProp::processValue(arr[0].getValue(PropNameC2)));
+      points.push_back(PointProp::processValue(arr[1].getValue(PropNameC1)));
+      points.push_back(PointProp::processValue(arr[1].getValue(PropNamePos)));
+      points.push_back(PointProp::processValue(arr[1].getValue(PropNameC2)));
+      points.push_back(PointProp::processValue(arr[2].getValue(PropNameC1)));
+      points.push_back(PointProp::processValue(arr[2].getValue(PropNamePos)));
+      points.push_back(PointProp::processValue(arr[2].getValue(PropNameC2)));
+      points.push_back(PointProp::processValue(arr[3].getValue(PropNameC1)));
+      points.push_back(PointProp::processValue(arr[3].getValue(PropNamePos)));
+      points.push_back(PointProp::processValue(arr[3].getValue(PropNameC2)));
+      points.push_back(PointProp::processValue(arr[0].getValue(PropNameC1)));
 
       setDerivedValue(std::move(points));
     }
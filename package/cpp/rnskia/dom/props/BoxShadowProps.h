@@ -11,12 +11,12 @@ class BoxShadowProps : public DerivedProp<SkPaint> {
 public:
   explicit BoxShadowProps(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedProp<SkPaint>(onChange) {
-    _dxProp = defineProperty<NodeProp>("dx");
-    _dyProp = defineProperty<NodeProp>("dy");
-    _spreadProp = defineProperty<NodeProp>("spread");
-    _blurProp = defineProperty<NodeProp>("blur");
-    _colorProp = defineProperty<ColorProp>("color");
-    _innerProp = defineProperty<NodeProp>("inner");
+    _dxProp = defineProperty<NodeProp>(PropNameDx);
+    _dyProp = defineProperty<NodeProp>(PropNameDy);
+    _spreadProp = defineProperty<NodeProp>(PropNameSpread);
+    _blurProp = defineProperty<NodeProp>(PropNameBlur);
+    _colorProp = defineProperty<ColorProp>(PropNameColor);
+    _innerProp = defineProperty<NodeProp>(PropNameInner);
 
     _blurProp->require();
   }
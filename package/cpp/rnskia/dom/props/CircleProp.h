@@ -14,17 +14,13 @@
 
 namespace RNSkia {
 
-static PropId PropNameCx = JsiPropId::get("cx");
-static PropId PropNameCy = JsiPropId::get("cy");
-static PropId PropNameC = JsiPropId::get("c");
-
 class CircleProp : public DerivedProp<SkPoint> {
 public:
   explicit CircleProp(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedProp<SkPoint>(onChange) {
-    _c = defineProperty<PointProp>("c");
-    _cx = defineProperty<NodeProp>("cx");
-    _cy = defineProperty<NodeProp>("cy");
+    _c = defineProperty<PointProp>(PropNameC);
+    _cx = defineProperty<NodeProp>(PropNameCx);
+    _cy = defineProperty<NodeProp>(PropNameCy);
   }
 
   void updateDerivedValue() override {
@@ -9,11 +9,6 @@
 
 namespace RNSkia {
 
-static PropId PropName0 = JsiPropId::get("0");
-static PropId PropName1 = JsiPropId::get("1");
-static PropId PropName2 = JsiPropId::get("2");
-static PropId PropName3 = JsiPropId::get("3");
-
 class ColorProp : public DerivedProp<SkColor> {
 public:
   explicit ColorProp(PropId name,
@@ -33,7 +28,13 @@ public:
   }
 
   static SkColor parseColorValue(const JsiValue &color) {
-    if (color.getType() == PropType::Object) {
+    if (color.getType() == PropType::TypedArray) {
+      // Float array of rgba values
+      auto &rgba = color.getAsTypedArray();
+      return SkColorSetARGB(
+          rgba.getAsNumber(3) * 255.0f, rgba.getAsNumber(0) * 255.0f,
+          rgba.getAsNumber(1) * 255.0f, rgba.getAsNumber(2) * 255.0f);
+    } else if (color.getType() == PropType::Object) {
       // Float array
       auto r = color.getValue(PropName0);
       auto g = color.getValue(PropName1);
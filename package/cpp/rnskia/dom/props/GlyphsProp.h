@@ -9,9 +9,6 @@
 
 namespace RNSkia {
 
-static PropId PropNamePos = JsiPropId::get("pos");
-static PropId PropNameId = JsiPropId::get("id");
-
 struct GlyphInfo {
   std::vector<SkGlyphID> glyphIds;
   std::vector<SkPoint> positions;
@@ -20,9 +20,6 @@ struct FitRects {
   SkRect dst;
 };
 
-static PropId PropNameImage = JsiPropId::get("image");
-static PropId PropNameFit = JsiPropId::get("fit");
-
 class ImageProp : public DerivedSkProp<SkImage> {
 public:
   explicit ImageProp(PropId name,
@@ -7,8 +7,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameMatrix = JsiPropId::get("matrix");
-
 class MatrixProp : public DerivedProp<SkMatrix> {
 public:
   explicit MatrixProp(PropId name,
@@ -28,7 +28,7 @@ public:
   }
 
   explicit PaintProp(const std::function<void(BaseNodeProp *)> &onChange)
-      : PaintProp(JsiPropId::get("paint"), onChange) {}
+      : PaintProp(PropNamePaint, onChange) {}
 
   void updateDerivedValue() override {
     if (_paintProp->isSet()) {
@@ -63,7 +63,7 @@ public:
 
   explicit PaintDrawingContextProp(
       const std::function<void(BaseNodeProp *)> &onChange)
-      : PaintDrawingContextProp(JsiPropId::get("paint"), onChange) {}
+      : PaintDrawingContextProp(PropNamePaint, onChange) {}
 
   void updateDerivedValue() override {
     if (_paintProp->isSet()) {
@@ -92,15 +92,15 @@ class PaintProps : public BaseDerivedProp {
 public:
   explicit PaintProps(const std::function<void(BaseNodeProp *)> &onChange)
       : BaseDerivedProp(onChange) {
-    _color = defineProperty<ColorProp>("color");
-    _style = defineProperty<NodeProp>("style");
-    _strokeWidth = defineProperty<NodeProp>("strokeWidth");
-    _blendMode = defineProperty<BlendModeProp>("blendMode");
-    _strokeJoin = defineProperty<StrokeJoinProp>("strokeJoin");
-    _strokeCap = defineProperty<StrokeCapProp>("strokeCap");
-    _strokeMiter = defineProperty<NodeProp>("strokeMiter");
-    _antiAlias = defineProperty<NodeProp>("antiAlias");
-    _opacity = defineProperty<NodeProp>("opacity");
+    _color = defineProperty<ColorProp>(PropNameColor);
+    _style = defineProperty<NodeProp>(PropNameStyle);
+    _strokeWidth = defineProperty<NodeProp>(PropNameStrokeWidth);
+    _blendMode = defineProperty<BlendModeProp>(PropNameBlendMode);
+    _strokeJoin = defineProperty<StrokeJoinProp>(PropNameStrokeJoin);
+    _strokeCap = defineProperty<StrokeCapProp>(PropNameStrokeCap);
+    _strokeMiter = defineProperty<NodeProp>(PropNameStrokeMiter);
+    _antiAlias = defineProperty<NodeProp>(PropNameAntiAlias);
+    _opacity = defineProperty<NodeProp>(PropNameOpacity);
   }
 
   void updateDerivedValue() override {}
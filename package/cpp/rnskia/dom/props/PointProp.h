@@ -15,9 +15,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameX = JsiPropId::get("x");
-static PropId PropNameY = JsiPropId::get("y");
-
 class PointProp : public DerivedProp<SkPoint> {
 public:
   explicit PointProp(PropId name,
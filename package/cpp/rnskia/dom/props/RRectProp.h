@@ -16,10 +16,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameRx = JsiPropId::get("rx");
-static PropId PropNameRy = JsiPropId::get("ry");
-static PropId PropNameR = JsiPropId::get("r");
-
 /**
  Reads a rect from a given propety in the node. The name of the property is
  provided on the constructor. The property can either be a Javascript property
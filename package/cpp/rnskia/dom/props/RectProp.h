@@ -14,10 +14,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameRect = JsiPropId::get("rect");
-static PropId PropNameWidth = JsiPropId::get("width");
-static PropId PropNameHeight = JsiPropId::get("height");
-
 /**
  Reads a rect from a given propety in the node. The name of the property is
  provided on the constructor. The property can either be a Javascript property
@@ -41,10 +41,10 @@ class TextPathBlobProp : public DerivedSkProp<SkTextBlob> {
 public:
   explicit TextPathBlobProp(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedSkProp<SkTextBlob>(onChange) {
-    _fontProp = defineProperty<FontProp>("font");
-    _textProp = defineProperty<NodeProp>("text");
-    _pathProp = defineProperty<PathProp>("path");
-    _offsetProp = defineProperty<NodeProp>("initialOffset");
+    _fontProp = defineProperty<FontProp>(PropNameFont);
+    _textProp = defineProperty<NodeProp>(PropNameText);
+    _pathProp = defineProperty<PathProp>(PropNamePath);
+    _offsetProp = defineProperty<NodeProp>(PropNameInitialOffset);
 
     _fontProp->require();
     _textProp->require();
@@ -8,16 +8,6 @@
 
 namespace RNSkia {
 
-static PropId PropNameTranslateX = JsiPropId::get("translateX");
-static PropId PropNameTranslateY = JsiPropId::get("translateY");
-static PropId PropNameScale = JsiPropId::get("scale");
-static PropId PropNameScaleX = JsiPropId::get("scaleX");
-static PropId PropNameScaleY = JsiPropId::get("scaleY");
-static PropId PropNameSkewX = JsiPropId::get("skewX");
-static PropId PropNameSkewY = JsiPropId::get("skewY");
-static PropId PropNameRotate = JsiPropId::get("rotate");
-static PropId PropNameRotateZ = JsiPropId::get("rotateZ");
-
 class TransformProp : public DerivedProp<SkMatrix> {
 public:
   explicit TransformProp(PropId name,
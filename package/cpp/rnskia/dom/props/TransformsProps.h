@@ -14,9 +14,9 @@ class TransformsProps : public DerivedProp<SkMatrix> {
 public:
   explicit TransformsProps(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedProp<SkMatrix>(onChange) {
-    _transformProp = defineProperty<TransformProp>("transform");
-    _originProp = defineProperty<PointProp>("origin");
-    _matrixProp = defineProperty<MatrixProp>("matrix");
+    _transformProp = defineProperty<TransformProp>(PropNameTransform);
+    _originProp = defineProperty<PointProp>(PropNameOrigin);
+    _matrixProp = defineProperty<MatrixProp>(PropNameMatrix);
   }
 
   void updateDerivedValue() override {
@@ -35,6 +35,16 @@ void processValue(std::vector<SkScalar> &values, const JsiValue &value) {
   if (value.getType() == PropType::Number) {
     auto n = value.getAsNumber();
     values.push_back(n);
+  } else if (value.getType() == PropType::TypedArray) {
+    auto &typedArray = value.getAsTypedArray();
+    if (typedArray.getKind() == TypedArrayKind::Float32Array) {
+      values.insert(values.end(), typedArray.data<float>(),
+                    typedArray.data<float>() + typedArray.size());
+    } else {
+      for (size_t i = 0; i < typedArray.size(); ++i) {
+        values.push_back(typedArray.getAsNumber(i));
+      }
+    }
   } else if (value.getType() == PropType::Array) {
     auto arrayValue = value.getAsArray();
     for (size_t i = 0; i < arrayValue.size(); ++i) {
@@ -72,8 +82,8 @@ void processUniform(std::vector<SkScalar> &values, SkRuntimeEffect *source,
     } else {
       std::vector<SkScalar> uniformValue;
       processValue(uniformValue, value);
-      rtb->uniform(name).set(uniformValue.data(),
-                             static_cast<int>(uniformValue.size()));
+      rtb->uniform(name.c_str())
+          .set(uniformValue.data(), static_cast<int>(uniformValue.size()));
     }
   }
 }
@@ -23,11 +23,11 @@ class VerticesProps : public DerivedSkProp<SkVertices> {
 public:
   explicit VerticesProps(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedSkProp<SkVertices>(onChange) {
-    _vertexModeProp = defineProperty<VertexModeProp>("mode");
-    _colorsProp = defineProperty<ColorsProp>("colors");
-    _verticesProp = defineProperty<PointsProp>("vertices");
-    _texturesProp = defineProperty<PointsProp>("textures");
-    _indicesProp = defineProperty<Numbers16Prop>("indices");
+    _vertexModeProp = defineProperty<VertexModeProp>(PropNameMode);
+    _colorsProp = defineProperty<ColorsProp>(PropNameColors);
+    _verticesProp = defineProperty<PointsProp>(PropNameVertices);
+    _texturesProp = defineProperty<PointsProp>(PropNameTextures);
+    _indicesProp = defineProperty<Numbers16Prop>(PropNameIndices);
 
     _vertexModeProp->require();
     _verticesProp->require();
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "DomTestFixture.h"
+
+namespace {
+
+// Only allocations made by the test thread are counted, the runtime may
+// allocate on its own threads
+thread_local bool isCountingAllocations = false;
+thread_local size_t allocationCount = 0;
+
+} // namespace
+
+void *operator new(std::size_t size) {
+  if (isCountingAllocations) {
+    allocationCount++;
+  }
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ Counts the allocations made with operator new on the calling thread while
+ in scope
+ */
+class AllocationCounter {
+public:
+  AllocationCounter() {
+    allocationCount = 0;
+    isCountingAllocations = true;
+  }
+
+  ~AllocationCounter() { isCountingAllocations = false; }
+
+  size_t getCount() { return allocationCount; }
+};
+
+// Number of groups in the scene, each drawing rects with their own paints
+constexpr size_t GroupCount = 250;
+
+/**
+ Static scene of about 1.2k nodes. Only rects are drawn, since Skia itself
+ allocates when rasterizing paths with a scaled matrix.
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+
+function build(groupCount) {
+  var root = api.GroupNode({});
+  root.addChild(api.FillNode({ color: "white" }));
+  for (var i = 0; i < groupCount; i++) {
+    var group = api.GroupNode({ opacity: 0.5 + (i % 5) / 10, transform: [
+      { translateX: (i % 16) * 8 }, { translateY: (i >> 4) * 8 }] });
+    group.addChild(api.RectNode({ x: 0, y: 0, width: 6, height: 6,
+      color: i % 2 ? "red" : "blue" }));
+    group.addChild(api.RectNode({ x: 1, y: 1, width: 4, height: 4,
+      color: "green", style: "stroke", strokeWidth: 0.5 }));
+    var outlined = api.RectNode({ x: 2, y: 2, width: 2, height: 2 });
+    outlined.addChild(api.PaintNode({ color: "black", style: "stroke",
+      strokeWidth: 0.25 }));
+    group.addChild(outlined);
+    root.addChild(group);
+  }
+  return root;
+}
+)";
+
+} // namespace
+
+/**
+ Draws frames of a static tree straight to a raster canvas
+ */
+class DomAllocationTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    eval(Scene);
+    _root = evalNode("build(" + std::to_string(GroupCount) + ")");
+    _surface = SkSurface::MakeRasterN32Premul(Width, Height);
+    _drawingContext = std::make_shared<DrawingContext>();
+    _drawingContext->setCanvas(_surface->getCanvas());
+  }
+
+  void TearDown() override {
+    _root->dispose(true);
+    _root = nullptr;
+    _drawingContext = nullptr;
+    DomTest::TearDown();
+  }
+
+  /**
+   Draws a frame like the renderer does, returning the number of allocations
+   made while drawing it
+   */
+  size_t renderFrame() {
+    AllocationCounter counter;
+    _root->commitPendingChanges();
+    _root->render(_drawingContext.get());
+    _root->resetPendingChanges();
+    return counter.getCount();
+  }
+
+  std::shared_ptr<JsiDomRenderNode> _root;
+  sk_sp<SkSurface> _surface;
+  std::shared_ptr<DrawingContext> _drawingContext;
+};
+
+TEST_F(DomAllocationTest, UnchangedFramesDoNotAllocate) {
+  // The first frame compiles the paints of the nodes
+  EXPECT_GT(renderFrame(), 0u);
+  // Unchanged frames drawn node by node, before the tree is retained
+  EXPECT_EQ(renderFrame(), 0u);
+  EXPECT_EQ(renderFrame(), 0u);
+}
+
+TEST_F(DomAllocationTest, RetainedFramesDoNotAllocate) {
+  // Until the tree is recorded into a retained picture
+  for (int i = 0; i < 10; i++) {
+    renderFrame();
+  }
+  for (int i = 0; i < 10; i++) {
+    SCOPED_TRACE("frame " + std::to_string(i));
+    EXPECT_EQ(renderFrame(), 0u);
+  }
+}
+
+TEST_F(DomAllocationTest, RetainsOnlyTheTopmostUnchangedSubtree) {
+  // The first frame compiles the paints of the nodes
+  renderFrame();
+  size_t maxAllocations = 0;
+  for (int i = 0; i < 10; i++) {
+    maxAllocations = std::max(maxAllocations, renderFrame());
+  }
+  // A picture recorded for each group would take several allocations each
+  EXPECT_LT(maxAllocations, GroupCount);
+}
+
+TEST_F(DomTest, StaticRendererFramesDoNotAllocate) {
+  eval(Scene);
+  auto renderer =
+      makeRenderer(evalNode("build(" + std::to_string(GroupCount) + ")"));
+  auto provider = makeCanvasProvider();
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(renderer->tryRender(provider));
+  }
+
+  // Nothing is damaged, the frame surface is copied to the canvas as is
+  for (int i = 0; i < 10; i++) {
+    SCOPED_TRACE("frame " + std::to_string(i));
+    AllocationCounter counter;
+    ASSERT_TRUE(renderer->tryRender(provider));
+    EXPECT_EQ(counter.getCount(), 0u);
+  }
+}
+
+} // namespace RNSkia
@@ -0,0 +1,157 @@
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "DomTestFixture.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ A group with a list of rects as children. order mirrors the order the
+ children should have once the moves are committed.
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+
+function buildList(count) {
+  var list = { root: api.GroupNode({}), order: [] };
+  for (var i = 0; i < count; i++) {
+    var child = api.RectNode({ x: i % 64, y: 0, width: 1, height: 1 });
+    list.root.addChild(child);
+    list.order.push(child);
+  }
+  return list;
+}
+
+function nextRandom(seed) {
+  return (seed * 1103515245 + 12345) % 2147483648;
+}
+
+// Moves each child before another one picked at random
+function shuffle(list, seed) {
+  var order = list.order;
+  for (var i = 0; i < order.length; i++) {
+    seed = nextRandom(seed);
+    var child = order[i];
+    var before = order[seed % order.length];
+    if (child === before) {
+      continue;
+    }
+    list.root.insertChildBefore(child, before);
+    order.splice(order.indexOf(child), 1);
+    order.splice(order.indexOf(before), 0, child);
+  }
+}
+
+// Moves without tracking the order, for timing
+function shuffleMoves(list, seed) {
+  var order = list.order;
+  for (var i = 0; i < order.length; i++) {
+    seed = nextRandom(seed);
+    var before = order[seed % order.length];
+    if (order[i] !== before) {
+      list.root.insertChildBefore(order[i], before);
+    }
+  }
+}
+)";
+
+} // namespace
+
+class DomChildrenTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    eval(Scene);
+  }
+
+  /**
+   Checks the children returned to JS against the expected order
+   */
+  ::testing::AssertionResult hasExpectedOrder(const std::string &list) {
+    auto children = eval(list + ".root.children()").asObject(*_runtime);
+    auto order = eval(list + ".order").asObject(*_runtime);
+    auto count = order.asArray(*_runtime).size(*_runtime);
+    if (children.asArray(*_runtime).size(*_runtime) != count) {
+      return ::testing::AssertionFailure() << "wrong number of children";
+    }
+    for (size_t i = 0; i < count; ++i) {
+      auto actual = children.asArray(*_runtime)
+                        .getValueAtIndex(*_runtime, i)
+                        .asObject(*_runtime)
+                        .getHostObject(*_runtime);
+      auto expected = order.asArray(*_runtime)
+                          .getValueAtIndex(*_runtime, i)
+                          .asObject(*_runtime)
+                          .getHostObject(*_runtime);
+      if (actual != expected) {
+        return ::testing::AssertionFailure() << "child " << i << " differs";
+      }
+    }
+    return ::testing::AssertionSuccess();
+  }
+};
+
+TEST_F(DomChildrenTest, MovesKeepTheOrderOfTheJsSide) {
+  eval("var list = buildList(100);");
+  auto root = evalNode("list.root");
+  root->commitPendingChanges();
+  root->resetPendingChanges();
+  ASSERT_TRUE(hasExpectedOrder("list"));
+
+  for (int seed = 1; seed <= 5; ++seed) {
+    SCOPED_TRACE("seed " + std::to_string(seed));
+    eval("shuffle(list, " + std::to_string(seed) + ");");
+    root->commitPendingChanges();
+    root->resetPendingChanges();
+    EXPECT_TRUE(hasExpectedOrder("list"));
+  }
+}
+
+TEST_F(DomChildrenTest, ChildrenCanBeReadWhileRendering) {
+  eval("var list = buildList(500);");
+  auto renderer = makeRenderer(evalNode("list.root"));
+  auto provider = makeCanvasProvider();
+  ASSERT_TRUE(renderer->tryRender(provider));
+
+  // The render thread commits the moves while the JS thread reads the
+  // children, as when the reconciler and the view run at the same time
+  std::atomic<bool> isDone = {false};
+  std::thread renderThread([&]() {
+    while (!isDone) {
+      renderer->tryRender(provider);
+    }
+  });
+  for (int seed = 1; seed <= 20; ++seed) {
+    eval("shuffle(list, " + std::to_string(seed) + ");");
+    EXPECT_EQ(eval("list.root.children().length").asNumber(), 500);
+  }
+  isDone = true;
+  renderThread.join();
+}
+
+TEST_F(DomChildrenTest, ShuffleTime) {
+  eval("var list = buildList(10000);");
+  auto root = evalNode("list.root");
+  root->commitPendingChanges();
+  root->resetPendingChanges();
+
+  double queueMs = 0;
+  double commitMs = 0;
+  for (int seed = 1; seed <= 10; ++seed) {
+    queueMs += timeMs(
+        [&]() { eval("shuffleMoves(list, " + std::to_string(seed) + ");"); });
+    commitMs += timeMs([&]() {
+      root->commitPendingChanges();
+      root->resetPendingChanges();
+    });
+  }
+
+  // 10 shuffles of 10k children
+  reportTiming("shuffleQueueMs", queueMs);
+  reportTiming("shuffleCommitMs", commitMs);
+}
+
+} // namespace RNSkia
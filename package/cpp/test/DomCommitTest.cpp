@@ -0,0 +1,158 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "DomTestFixture.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ A chain of nested groups, each holding a rect before the next group
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+var depth = 8;
+var root = api.GroupNode({});
+var groups = [];
+var rects = [];
+var parent = root;
+for (var i = 0; i < depth; i++) {
+  var group = api.GroupNode({});
+  var rect = api.RectNode({ x: i, y: i, width: 10, height: 10 });
+  group.addChild(rect);
+  parent.addChild(group);
+  groups.push(group);
+  rects.push(rect);
+  parent = group;
+}
+var path = api.PathNode({ path: "M 0 0 L 20 20 L 0 20 Z" });
+)";
+
+const size_t Depth = 8;
+
+/**
+ A group with a list of rects, animated one prop at a time as by an
+ animation driving each of them
+ */
+const char *Grid = R"(
+var api = SkiaDomApi;
+var grid = api.GroupNode({});
+var cells = [];
+for (var i = 0; i < 10000; i++) {
+  var cell = api.RectNode({ x: i % 256, y: 0, width: 1, height: 1 });
+  grid.addChild(cell);
+  cells.push(cell);
+}
+
+function animate(frame) {
+  for (var i = 0; i < cells.length; i++) {
+    cells[i].setProp("y", (i + frame) % 256);
+  }
+}
+
+function animateWithSetProps(frame) {
+  for (var i = 0; i < cells.length; i++) {
+    cells[i].setProps({ x: i % 256, y: (i + frame) % 256, width: 1,
+      height: 1 });
+  }
+}
+)";
+
+} // namespace
+
+class DomCommitTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    eval(Scene);
+    _root = evalNode("root");
+    ASSERT_EQ(commit(), 2 * Depth + 1);
+  }
+
+  /**
+   Commits the pending changes, returning the number of nodes committed
+   */
+  size_t commit() {
+    auto committedNodes = _root->commitPendingChanges();
+    _root->resetPendingChanges();
+    return committedNodes;
+  }
+
+  std::shared_ptr<JsiDomRenderNode> _root;
+};
+
+TEST_F(DomCommitTest, UnchangedSubtreesAreSkipped) {
+  EXPECT_EQ(commit(), 0);
+  eval("rects[0].setProp('x', 5);");
+  EXPECT_EQ(commit(), 3);
+  EXPECT_EQ(commit(), 0);
+}
+
+TEST_F(DomCommitTest, ChangesCommitThePathFromTheRoot) {
+  eval("rects[depth - 1].setProp('x', 5);");
+  EXPECT_EQ(commit(), Depth + 2);
+  eval("groups[3].setProp('opacity', 0.5);");
+  EXPECT_EQ(commit(), 5);
+}
+
+TEST_F(DomCommitTest, ChangesUnderADirtyAncestorAreCommitted) {
+  // The second change stops at an ancestor marked by the first one, in both
+  // orders
+  eval("rects[depth - 1].setProp('x', 5); rects[2].setProp('x', 5);");
+  EXPECT_EQ(commit(), Depth + 3);
+  eval("rects[2].setProp('x', 6); rects[depth - 1].setProp('x', 6);");
+  EXPECT_EQ(commit(), Depth + 3);
+  eval("rects[2].setProp('x', 7); rects[1].setProp('x', 7);");
+  EXPECT_EQ(commit(), 6);
+}
+
+TEST_F(DomCommitTest, FailedCommitsAreRetried) {
+  eval("groups[1].insertChildBefore(path, groups[2]);");
+  EXPECT_EQ(commit(), 4);
+
+  // The commit stops at the path, before the groups below it
+  eval("path.setProp('path', 'not a path');"
+       "rects[depth - 1].setProp('x', 5);");
+  EXPECT_THROW(_root->commitPendingChanges(), std::runtime_error);
+  EXPECT_THROW(_root->commitPendingChanges(), std::runtime_error);
+
+  eval("path.setProp('path', 'M 0 0 L 10 10 L 0 10 Z');");
+  EXPECT_EQ(commit(), Depth + 3);
+  eval("rects[depth - 1].setProp('x', 6);");
+  EXPECT_EQ(commit(), Depth + 2);
+}
+
+TEST_F(DomTest, SetPropTime) {
+  eval(Grid);
+  auto root = evalNode("grid");
+  root->commitPendingChanges();
+  root->resetPendingChanges();
+
+  auto time = [&](const std::string &animate, double *setMs,
+                  double *commitMs) {
+    for (int frame = 1; frame <= 10; ++frame) {
+      *setMs += timeMs(
+          [&]() { eval(animate + "(" + std::to_string(frame) + ");"); });
+      *commitMs += timeMs([&]() {
+        root->commitPendingChanges();
+        root->resetPendingChanges();
+      });
+    }
+  };
+  double setPropMs = 0;
+  double setPropCommitMs = 0;
+  time("animate", &setPropMs, &setPropCommitMs);
+  double setPropsMs = 0;
+  double setPropsCommitMs = 0;
+  time("animateWithSetProps", &setPropsMs, &setPropsCommitMs);
+
+  // 10 frames of 10k updates
+  reportTiming("setPropMs", setPropMs);
+  reportTiming("setPropCommitMs", setPropCommitMs);
+  reportTiming("setPropsMs", setPropsMs);
+  reportTiming("setPropsCommitMs", setPropsCommitMs);
+}
+
+} // namespace RNSkia
@@ -0,0 +1,86 @@
+#include "DomTestFixture.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ Builds the same grid of nodes with the node constructors and with a single
+ createTree call.
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+
+function cellProps(i) {
+  return { x: (i % 32) * 8, y: Math.floor(i / 32) * 8, width: 6, height: 6,
+    color: i % 2 ? "red" : "blue", opacity: 0.5 + (i % 5) / 10 };
+}
+
+function mountWithConstructors(count) {
+  var root = api.GroupNode({});
+  root.addChild(api.FillNode({ color: "white" }));
+  for (var i = 0; i < count; i++) {
+    var group = api.GroupNode({ transform: [{ rotate: (i % 7) / 100 }] });
+    group.addChild(api.RectNode(cellProps(i)));
+    root.addChild(group);
+  }
+  return root;
+}
+
+function mountWithCreateTree(count) {
+  var children = [["FillNode", { color: "white" }]];
+  for (var i = 0; i < count; i++) {
+    children.push(["GroupNode", { transform: [{ rotate: (i % 7) / 100 }] },
+      [["RectNode", cellProps(i)]]]);
+  }
+  return api.createTree(["GroupNode", {}, children])[0];
+}
+)";
+
+} // namespace
+
+TEST_F(DomTest, CreateTreeMatchesNodeConstructors) {
+  eval(Scene);
+
+  auto expected = makeCanvasProvider();
+  {
+    auto renderer = makeRenderer(evalNode("mountWithConstructors(1024)"));
+    ASSERT_TRUE(renderer->tryRender(expected));
+  }
+
+  auto actual = makeCanvasProvider();
+  {
+    auto renderer = makeRenderer(evalNode("mountWithCreateTree(1024)"));
+    ASSERT_TRUE(renderer->tryRender(actual));
+  }
+
+  EXPECT_TRUE(equalPixels(actual->readPixels(), expected->readPixels()));
+}
+
+TEST_F(DomTest, CreateTreeMountTime) {
+  eval(Scene);
+
+  // Warm up both paths before timing them
+  eval("mountWithConstructors(64); mountWithCreateTree(64);");
+
+  auto constructorsMs = timeMs([this]() {
+    eval("for (var r = 0; r < 10; r++) mountWithConstructors(1024);");
+  });
+  auto createTreeMs = timeMs([this]() {
+    eval("for (var r = 0; r < 10; r++) mountWithCreateTree(1024);");
+  });
+
+  // Mounting 10 x 2050 nodes
+  reportTiming("constructorsMs", constructorsMs);
+  reportTiming("createTreeMs", createTreeMs);
+}
+
+TEST_F(DomTest, CreateTreeRejectsAnimatedProps) {
+  eval(Scene);
+  EXPECT_THROW(eval("api.createTree(['RectNode', { x: 0, y: 0, width: 10, "
+                    "height: 10, color: { value: 1, selector: "
+                    "function (v) { return v; } } }]);"),
+               jsi::JSError);
+}
+
+} // namespace RNSkia
@@ -0,0 +1,258 @@
+#include <string>
+
+#include "DomTestFixture.h"
+#include "JsiSkPath.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ Scene with static and changing subtrees. build creates the tree for a state,
+ update applies a state to a tree created by build.
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+
+function build(state) {
+  var scene = {
+    root: api.GroupNode({}),
+    moving: api.GroupNode({}),
+    square: api.RectNode({ x: 10, y: 10, width: 40, height: 30 }),
+    ring: api.CircleNode({ cx: 80, cy: 40, r: 15 }),
+    badge: api.RectNode({ x: 0, y: 0, width: 20, height: 20 }),
+    dot: api.CircleNode({ cx: 30, cy: 100, r: 6, color: "purple" }),
+    background: api.FillNode({ color: "white" }),
+    still: api.GroupNode({ transform: [{ translateY: 70 }] }),
+  };
+  scene.still.addChild(api.OvalNode({ x: 10, y: 10, width: 50, height: 20,
+    color: "orange" }));
+  scene.still.addChild(api.RRectNode({ x: 70, y: 5, width: 40, height: 40,
+    r: 8, color: "teal", style: "stroke", strokeWidth: 3 }));
+  scene.moving.addChild(scene.square);
+  scene.moving.addChild(scene.ring);
+  scene.root.addChild(scene.background);
+  scene.root.addChild(scene.moving);
+  scene.root.addChild(scene.badge);
+  scene.root.addChild(scene.still);
+  update(scene, state);
+  return scene;
+}
+
+function update(scene, state) {
+  scene.background.setProps({ color: state.background || "white" });
+  scene.moving.setProps({ transform: [{ translateX: state.offset }] });
+  scene.square.setProps({ x: 10, y: 10, width: 40, height: 30,
+    color: state.color });
+  scene.ring.setProps({ cx: 80, cy: 40, r: 15, color: "blue",
+    style: "stroke", strokeWidth: 4 });
+  scene.badge.setProps({ x: state.badge, y: 15.5, width: 20, height: 20,
+    color: "red", opacity: 0.5 });
+  if (state.dot && !scene.hasDot) {
+    scene.moving.addChild(scene.dot);
+  } else if (!state.dot && scene.hasDot) {
+    scene.moving.removeChild(scene.dot);
+  }
+  scene.hasDot = state.dot;
+}
+
+var states = [
+  { offset: 0, color: "green", badge: 100, dot: false },
+  { offset: 0, color: "green", badge: 100, dot: false },
+  { offset: 0, color: "yellow", badge: 100, dot: false },
+  { offset: 12.25, color: "yellow", badge: 100, dot: false },
+  { offset: 12.25, color: "yellow", badge: 60.75, dot: false },
+  { offset: 12.25, color: "yellow", badge: 60.75, dot: true },
+  { offset: 3, color: "green", badge: 110, dot: true },
+  { offset: 3, color: "green", badge: 110, dot: false },
+];
+
+// Damaged in full by the background, long enough for the renderer to stop
+// measuring frames and to measure one again, then damaged in part again
+var animatedStates = [];
+for (var i = 0; i < 40; i++) {
+  animatedStates.push({ offset: i, color: "green", badge: 100, dot: false,
+    background: i % 2 ? "white" : "ivory" });
+}
+animatedStates = animatedStates.concat(states);
+
+/**
+ Grid of groups for the frame time benchmark. Either a single group moves or
+ the background changes with each frame, which damages the whole frame.
+ */
+function buildGrid(groupCount) {
+  var grid = { root: api.GroupNode({}), background: api.FillNode({}) };
+  grid.root.addChild(grid.background);
+  for (var i = 0; i < groupCount; i++) {
+    var group = api.GroupNode({ transform: [
+      { translateX: (i % 16) * 8 }, { translateY: (i >> 4) * 8 }] });
+    group.addChild(api.RectNode({ x: 0, y: 0, width: 6, height: 6,
+      color: i % 2 ? "red" : "blue" }));
+    group.addChild(api.CircleNode({ cx: 3, cy: 3, r: 2, color: "green",
+      style: "stroke", strokeWidth: 0.5 }));
+    grid.root.addChild(group);
+  }
+  grid.moving = api.RectNode({ x: 0, y: 0, width: 4, height: 4 });
+  grid.root.addChild(grid.moving);
+  return grid;
+}
+
+function animateGrid(grid, frame, isFullyAnimated) {
+  if (isFullyAnimated) {
+    grid.background.setProp("color", frame % 2 ? "white" : "ivory");
+  } else {
+    grid.moving.setProp("x", frame % 100);
+  }
+}
+)";
+
+} // namespace
+
+/**
+ Checks the frames drawn for each state of a scene against the frames of a
+ new tree drawn in full by a new renderer
+ */
+class DomDamageTest : public DomTest {
+protected:
+  void expectFramesMatchFullRedraw(const std::string &states,
+                                   bool isPreservingContents) {
+    eval(Scene);
+    eval("var current = build(" + states + "[0]);");
+    auto stateCount =
+        static_cast<size_t>(eval(states + ".length").asNumber());
+
+    auto renderer = makeRenderer(evalNode("current.root"));
+    auto provider = makeCanvasProvider(isPreservingContents);
+    ASSERT_TRUE(renderer->tryRender(provider));
+
+    for (size_t i = 1; i < stateCount; ++i) {
+      SCOPED_TRACE("state " + std::to_string(i));
+      auto state = states + "[" + std::to_string(i) + "]";
+      eval("update(current, " + state + ");");
+      ASSERT_TRUE(renderer->tryRender(provider));
+
+      auto expected = makeCanvasProvider();
+      {
+        auto reference = makeRenderer(evalNode("build(" + state + ").root"));
+        ASSERT_TRUE(reference->tryRender(expected));
+      }
+
+      EXPECT_TRUE(
+          equalPixels(provider->readPixels(), expected->readPixels()));
+    }
+  }
+};
+
+TEST_F(DomDamageTest, DamagedRedrawMatchesFullRedraw) {
+  expectFramesMatchFullRedraw("states", false);
+}
+
+TEST_F(DomDamageTest, DamagedRedrawInPlaceMatchesFullRedraw) {
+  // Drawn straight to the canvas, without the frame surface
+  expectFramesMatchFullRedraw("states", true);
+}
+
+TEST_F(DomDamageTest, FullyDamagedFramesMatchFullRedraw) {
+  expectFramesMatchFullRedraw("animatedStates", false);
+  expectFramesMatchFullRedraw("animatedStates", true);
+}
+
+TEST_F(DomTest, DamagedRedrawSkipsUnchangedSubtrees) {
+  eval(Scene);
+  eval("var current = build(states[0]);");
+
+  auto renderer = makeRenderer(evalNode("current.root"));
+  auto provider = makeCanvasProvider();
+  ASSERT_TRUE(renderer->tryRender(provider));
+
+  // The badge moves away from the static group, which is outside the damage
+  eval("update(current, { offset: 0, color: 'green', badge: 60.75, "
+       "dot: false });");
+  ASSERT_TRUE(renderer->tryRender(provider));
+  EXPECT_GT(renderer->getDamageCulledNodeCount(), 0u);
+  EXPECT_EQ(renderer->getClipCulledNodeCount(), 0u);
+}
+
+TEST_F(DomTest, OffCanvasNodesAreCulled) {
+  auto root = evalNode(R"(
+    var api = SkiaDomApi;
+    var root = api.GroupNode({});
+    root.addChild(api.RectNode({ x: 0, y: 0, width: 20, height: 20,
+      color: "red" }));
+    root.addChild(api.CircleNode({ cx: 500, cy: 40, r: 10 }));
+    var outlined = api.RectNode({ x: -100, y: 10, width: 20, height: 20 });
+    outlined.addChild(api.PaintNode({ style: "stroke", strokeWidth: 2 }));
+    root.addChild(outlined);
+    root;
+  )");
+  auto renderer = makeRenderer(root);
+  auto provider = makeCanvasProvider();
+  ASSERT_TRUE(renderer->tryRender(provider));
+
+  // The circle, and the outlined rect with both of its paints. The first
+  // frame is damaged in full, so nothing is culled to the damage.
+  EXPECT_EQ(renderer->getClipCulledNodeCount(), 3u);
+  EXPECT_EQ(renderer->getDamageCulledNodeCount(), 0u);
+}
+
+TEST_F(DomTest, CullingFollowsPathsChangedInPlace) {
+  auto path = std::make_shared<JsiSkPath>(_context, SkPath::Circle(500, 40, 10));
+  _runtime->global().setProperty(
+      *_runtime, "skPath", jsi::Object::createFromHostObject(*_runtime, path));
+  auto renderer = makeRenderer(evalNode(R"(
+    var root = SkiaDomApi.GroupNode({});
+    root.addChild(SkiaDomApi.PathNode({ path: skPath, color: "red" }));
+    root;
+  )"));
+  auto provider = makeCanvasProvider();
+  ASSERT_TRUE(renderer->tryRender(provider));
+  EXPECT_EQ(renderer->getClipCulledNodeCount(), 1u);
+
+  // Moved onto the canvas, the bounds it was culled with are stale
+  eval("skPath.offset(-460, 0);");
+  ASSERT_TRUE(renderer->tryRender(provider));
+  EXPECT_EQ(renderer->getClipCulledNodeCount(), 0u);
+  EXPECT_EQ(provider->readPixels().getColor(40 * PixelDensity,
+                                            40 * PixelDensity),
+            SK_ColorRED);
+}
+
+TEST_F(DomTest, DamagedFrameTime) {
+  eval(Scene);
+  constexpr int FrameCount = 200;
+
+  // Frames are timed against frames drawn in full, as renderImmediate does
+  auto time = [this](bool isFullyAnimated, bool isImmediate) {
+    eval("var grid = buildGrid(256);");
+    auto renderer = makeRenderer(evalNode("grid.root"));
+    auto provider = makeCanvasProvider();
+    auto animate = [&](int frame) {
+      eval("animateGrid(grid, " + std::to_string(frame) + ", " +
+           (isFullyAnimated ? "true" : "false") + ");");
+    };
+    // Warm up the paints and caches of the nodes
+    for (int i = 0; i < 10; ++i) {
+      animate(i);
+      renderer->tryRender(provider);
+    }
+    double ms = 0;
+    for (int i = 0; i < FrameCount; ++i) {
+      animate(i);
+      ms += timeMs([&]() {
+        if (isImmediate) {
+          renderer->renderImmediate(provider);
+        } else {
+          renderer->tryRender(provider);
+        }
+      });
+    }
+    return ms;
+  };
+
+  reportTiming("partialDamageMs", time(false, false));
+  reportTiming("partialDamageFullRedrawMs", time(false, true));
+  reportTiming("fullDamageMs", time(true, false));
+  reportTiming("fullDamageFullRedrawMs", time(true, true));
+}
+
+} // namespace RNSkia
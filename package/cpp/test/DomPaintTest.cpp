@@ -0,0 +1,53 @@
+#include <memory>
+#include <string>
+
+#include "DomTestFixture.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ A circle drawn once more with a stroked child paint with the given props
+ */
+const char *Scene = R"(
+var api = SkiaDomApi;
+
+function withChildPaint(props) {
+  var root = api.GroupNode({});
+  var circle = api.CircleNode({ cx: 64, cy: 64, r: 40, color: "red",
+    antiAlias: false });
+  props.color = "blue";
+  props.style = "stroke";
+  props.strokeWidth = 5;
+  circle.addChild(api.PaintNode(props));
+  root.addChild(circle);
+  return root;
+}
+)";
+
+} // namespace
+
+class DomPaintTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    eval(Scene);
+  }
+
+  SkBitmap draw(const std::string &props) {
+    auto provider = makeCanvasProvider();
+    auto renderer = makeRenderer(evalNode("withChildPaint(" + props + ")"));
+    EXPECT_TRUE(renderer->tryRender(provider));
+    return provider->readPixels();
+  }
+};
+
+TEST_F(DomPaintTest, ChildPaintsAreAntiAliasedByDefault) {
+  // Whatever the paint of the node drawing them is
+  auto byDefault = draw("{}");
+  EXPECT_TRUE(equalPixels(byDefault, draw("{ antiAlias: true }")));
+  EXPECT_FALSE(equalPixels(byDefault, draw("{ antiAlias: false }")));
+}
+
+} // namespace RNSkia
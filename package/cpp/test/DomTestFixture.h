@@ -0,0 +1,227 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+
+#include "JsiDomApi.h"
+#include "RNSkDomView.h"
+#include "RNSkPlatformContext.h"
+#include "RuntimeAwareCache.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkBitmap.h"
+#include "SkSurface.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+namespace jsi = facebook::jsi;
+namespace react = facebook::react;
+
+/**
+ Call invoker that queues calls scheduled on the JS thread until the test
+ flushes them.
+ */
+class TestCallInvoker : public react::CallInvoker {
+public:
+  void invokeAsync(std::function<void()> &&func) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.push_back(std::move(func));
+  }
+
+  void invokeSync(std::function<void()> &&func) override { func(); }
+
+  void flush() {
+    std::deque<std::function<void()>> pending;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      pending.swap(_pending);
+    }
+    for (auto &func : pending) {
+      func();
+    }
+  }
+
+private:
+  std::mutex _mutex;
+  std::deque<std::function<void()>> _pending;
+};
+
+/**
+ Platform context running main thread calls inline and creating raster
+ offscreen surfaces.
+ */
+class TestPlatformContext : public RNSkPlatformContext {
+public:
+  TestPlatformContext(jsi::Runtime *runtime,
+                      std::shared_ptr<react::CallInvoker> callInvoker,
+                      float pixelDensity)
+      : RNSkPlatformContext(runtime, callInvoker, pixelDensity) {}
+
+  void runOnMainThread(std::function<void()> func) override { func(); }
+
+  sk_sp<SkImage> takeScreenshotFromViewTag(size_t tag) override {
+    return nullptr;
+  }
+
+  void performStreamOperation(
+      const std::string &sourceUri,
+      const std::function<void(std::unique_ptr<SkStreamAsset>)> &op) override {
+  }
+
+  void raiseError(const std::exception &err) override {
+    ADD_FAILURE() << err.what();
+  }
+
+  sk_sp<SkSurface> makeOffscreenSurface(int width, int height) override {
+    return SkSurface::MakeRasterN32Premul(width, height);
+  }
+};
+
+/**
+ Canvas provider rendering into a raster surface of the given size in pixels.
+ The surface is kept between frames, but the provider only reports it when
+ created with isPreservingContents, like platform canvases that don't.
+ */
+class TestCanvasProvider : public RNSkCanvasProvider {
+public:
+  TestCanvasProvider(int width, int height, bool isPreservingContents = false)
+      : RNSkCanvasProvider([]() {}),
+        _surface(SkSurface::MakeRasterN32Premul(width, height)),
+        _isPreservingContents(isPreservingContents) {}
+
+  float getScaledWidth() override { return _surface->width(); }
+
+  float getScaledHeight() override { return _surface->height(); }
+
+  void renderToCanvas(const std::function<void(SkCanvas *)> &cb) override {
+    cb(_surface->getCanvas());
+  }
+
+  bool isPreservingContents() override { return _isPreservingContents; }
+
+  SkBitmap readPixels() {
+    SkBitmap bitmap;
+    bitmap.allocPixels(_surface->imageInfo());
+    _surface->readPixels(bitmap, 0, 0);
+    return bitmap;
+  }
+
+private:
+  sk_sp<SkSurface> _surface;
+  bool _isPreservingContents;
+};
+
+/**
+ Fixture with a Hermes runtime where the SkiaDomApi is installed as a global,
+ the same way the reconciler sees it.
+ */
+class DomTest : public ::testing::Test {
+protected:
+  static constexpr float PixelDensity = 2;
+  static constexpr int Width = 256;
+  static constexpr int Height = 256;
+
+  void SetUp() override {
+    _runtime = facebook::hermes::makeHermesRuntime();
+    // As the manager does for the JS runtime of the app
+    RNJsi::BaseRuntimeAwareCache::setMainJsRuntime(_runtime.get());
+    _callInvoker = std::make_shared<TestCallInvoker>();
+    _context = std::make_shared<TestPlatformContext>(
+        _runtime.get(), _callInvoker, PixelDensity);
+    _runtime->global().setProperty(
+        *_runtime, "SkiaDomApi",
+        jsi::Object::createFromHostObject(
+            *_runtime, std::make_shared<JsiDomApi>(_context)));
+  }
+
+  void TearDown() override {
+    _runtime->global().setProperty(*_runtime, "SkiaDomApi",
+                                   jsi::Value::undefined());
+    _callInvoker->flush();
+    _context = nullptr;
+    _runtime = nullptr;
+  }
+
+  jsi::Value eval(const std::string &code) {
+    return _runtime->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(code), "test.js");
+  }
+
+  std::shared_ptr<JsiDomRenderNode> evalNode(const std::string &code) {
+    auto value = eval(code);
+    return std::dynamic_pointer_cast<JsiDomRenderNode>(
+        value.asObject(*_runtime).getHostObject(*_runtime));
+  }
+
+  std::shared_ptr<RNSkDomRenderer>
+  makeRenderer(std::shared_ptr<JsiDomRenderNode> root) {
+    auto renderer = std::make_shared<RNSkDomRenderer>([]() {}, _context);
+    renderer->setRoot(root);
+    return renderer;
+  }
+
+  static std::shared_ptr<TestCanvasProvider>
+  makeCanvasProvider(bool isPreservingContents = false) {
+    return std::make_shared<TestCanvasProvider>(Width, Height,
+                                                isPreservingContents);
+  }
+
+  /**
+   Returns the time in milliseconds it takes to run the function
+   */
+  template <typename F> static double timeMs(F &&func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+
+  /**
+   Reports the timing of a benchmark. Timings are reported rather than
+   asserted, they depend on the machine.
+   */
+  static void reportTiming(const std::string &name, double ms) {
+    std::cout << name << ": " << ms << " ms" << std::endl;
+    RecordProperty(name, std::to_string(ms));
+  }
+
+  /**
+   Compares two bitmaps pixel for pixel, reporting the first mismatch.
+   */
+  static ::testing::AssertionResult equalPixels(const SkBitmap &actual,
+                                                const SkBitmap &expected) {
+    for (int y = 0; y < expected.height(); ++y) {
+      for (int x = 0; x < expected.width(); ++x) {
+        auto a = actual.getColor(x, y);
+        auto e = expected.getColor(x, y);
+        if (a != e) {
+          return ::testing::AssertionFailure()
+                 << "pixel (" << x << ", " << y << ") is " << std::hex << a
+                 << ", expected " << e;
+        }
+      }
+    }
+    return ::testing::AssertionSuccess();
+  }
+
+  std::unique_ptr<jsi::Runtime> _runtime;
+  std::shared_ptr<TestCallInvoker> _callInvoker;
+  std::shared_ptr<TestPlatformContext> _context;
+};
+
+} // namespace RNSkia
@@ -0,0 +1,117 @@
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "ColorProp.h"
+#include "DomTestFixture.h"
+#include "NodePropInterpolation.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ Builds descriptors the way InterpolateSelector and InterpolateColorsSelector
+ do
+ */
+const char *Descriptors = R"(
+function descriptor(interpolation) {
+  var type = interpolation.type || "extend";
+  return {
+    inputRange: interpolation.inputRange,
+    outputRange: interpolation.outputRange,
+    extrapolateLeft: type,
+    extrapolateRight: type,
+  };
+}
+
+function colorDescriptor(colors) {
+  return {
+    inputRange: colors.inputRange,
+    outputRange: colors.outputRange,
+    extrapolateLeft: "clamp",
+    extrapolateRight: "clamp",
+    color: true,
+  };
+}
+)";
+
+} // namespace
+
+/**
+ Checks the native evaluation against the outputs of interpolate and
+ interpolateColors in the corpus shared with selector.spec.tsx
+ */
+class InterpolationTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    std::ifstream file(INTERPOLATIONS_CORPUS);
+    ASSERT_TRUE(file.good()) << "Missing corpus " << INTERPOLATIONS_CORPUS;
+    std::stringstream json;
+    json << file.rdbuf();
+    eval("var corpus = " + json.str() + ";");
+    eval(Descriptors);
+    _inputCount = static_cast<size_t>(eval("corpus.inputs.length").asNumber());
+  }
+
+  /**
+   Evaluates the interpolation natively for the input at the given index
+   */
+  jsi::Value apply(const std::string &descriptor, size_t input) {
+    NodePropInterpolation interpolation(JsiValue(*_runtime, eval(descriptor)));
+    auto value = std::make_shared<RNSkReadonlyValue>(_context);
+    value->update(*_runtime, eval(getInput(input)));
+    return interpolation.apply(*_runtime, *value);
+  }
+
+  static std::string getInput(size_t input) {
+    return "corpus.inputs[" + std::to_string(input) + "]";
+  }
+
+  size_t _inputCount = 0;
+};
+
+TEST_F(InterpolationTest, MatchesInterpolate) {
+  auto count = static_cast<size_t>(
+      eval("corpus.interpolations.length").asNumber());
+  ASSERT_GT(count, 0u);
+  for (size_t i = 0; i < count; ++i) {
+    auto interpolation = "corpus.interpolations[" + std::to_string(i) + "]";
+    for (size_t j = 0; j < _inputCount; ++j) {
+      SCOPED_TRACE(interpolation + " at " + getInput(j));
+      auto expected =
+          eval(interpolation + ".outputs[" + std::to_string(j) + "]");
+      auto actual = apply("descriptor(" + interpolation + ")", j);
+      // Exact, the native evaluation must round like JS
+      EXPECT_EQ(actual.asNumber(), expected.asNumber());
+    }
+  }
+}
+
+TEST_F(InterpolationTest, InterpolatesArraysElementWise) {
+  auto descriptor = "({ inputRange: [0, 1], outputRange: [[0, 10], [1, -10]], "
+                    "extrapolateLeft: 'clamp', extrapolateRight: 'clamp' })";
+  eval("corpus.inputs.push(0.5, 2);");
+  auto half = apply(descriptor, _inputCount).asObject(*_runtime);
+  EXPECT_EQ(half.asArray(*_runtime).size(*_runtime), 2u);
+  EXPECT_EQ(half.getProperty(*_runtime, "0").asNumber(), 0.5);
+  EXPECT_EQ(half.getProperty(*_runtime, "1").asNumber(), 0);
+  auto clamped = apply(descriptor, _inputCount + 1).asObject(*_runtime);
+  EXPECT_EQ(clamped.getProperty(*_runtime, "0").asNumber(), 1);
+  EXPECT_EQ(clamped.getProperty(*_runtime, "1").asNumber(), -10);
+}
+
+TEST_F(InterpolationTest, MatchesInterpolateColors) {
+  for (size_t j = 0; j < _inputCount; ++j) {
+    SCOPED_TRACE(getInput(j));
+    // Float32Array returned by interpolateColors, converted like ColorProp
+    auto expected = ColorProp::parseColorValue(JsiValue(
+        *_runtime, eval("new Float32Array(corpus.colors.outputs[" +
+                        std::to_string(j) + "])")));
+    auto actual = apply("colorDescriptor(corpus.colors)", j);
+    EXPECT_EQ(static_cast<SkColor>(actual.asNumber()), expected);
+  }
+}
+
+} // namespace RNSkia
@@ -0,0 +1,275 @@
+#include <string>
+
+#include "DomTestFixture.h"
+#include "JsiSkPath.h"
+
+namespace RNSkia {
+
+namespace {
+
+const char *Scene = R"(
+var api = SkiaDomApi;
+var root = api.GroupNode({});
+var group = api.GroupNode({});
+var rect = api.RectNode({ x: 10, y: 10, width: 40, height: 30,
+  color: "red" });
+var path = api.PathNode({ path: "M 0 0 L 20 20 L 0 20 Z" });
+var shape = api.PathNode({ path: skPath, color: "green" });
+var blur = api.BlurMaskFilterNode({ blur: 4 });
+var gradient = api.LinearGradientNode({ start: { x: 0, y: 0 },
+  end: { x: 50, y: 0 }, colors: ["red", "blue"] });
+group.addChild(rect);
+group.addChild(path);
+group.addChild(shape);
+root.addChild(group);
+)";
+
+} // namespace
+
+/**
+ Checks which cached state the commit pass invalidates for each kind of
+ change, on a scene drawn once so that the initial invalidations are consumed.
+ */
+class InvalidationTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    // Path host object changed in place by the tests
+    _runtime->global().setProperty(
+        *_runtime, "skPath",
+        jsi::Object::createFromHostObject(
+            *_runtime, std::make_shared<JsiSkPath>(
+                           _context, SkPath::Circle(60, 60, 10))));
+    eval(Scene);
+    _root = evalNode("root");
+    _renderer = makeRenderer(_root);
+    ASSERT_TRUE(_renderer->tryRender(makeCanvasProvider()));
+  }
+
+  std::shared_ptr<JsiDomNode> getNode(const std::string &name) {
+    return std::dynamic_pointer_cast<JsiDomNode>(
+        eval(name).asObject(*_runtime).getHostObject(*_runtime));
+  }
+
+  /**
+   Runs the change and commits it, returning the invalidations it added to
+   the node. Whether the node has committed changes is returned in changed.
+   */
+  NodeInvalidationMask commit(const std::string &change,
+                              const std::string &name,
+                              bool *changed = nullptr) {
+    auto node = getNode(name);
+    eval(change);
+    auto before = node->getInvalidations();
+    _root->commitPendingChanges();
+    auto added = node->getInvalidations() & ~before;
+    if (changed != nullptr) {
+      *changed = node->hasCommittedChanges();
+    }
+    _root->resetPendingChanges();
+    return added;
+  }
+
+  std::shared_ptr<JsiDomRenderNode> _root;
+  std::shared_ptr<RNSkDomRenderer> _renderer;
+};
+
+TEST_F(InvalidationTest, ConsumedByTheFirstRender) {
+  for (auto name : {"root", "group", "rect"}) {
+    SCOPED_TRACE(name);
+    EXPECT_EQ(getNode(name)->getInvalidations() & InvalidatesPaint,
+              InvalidatesNone);
+  }
+  EXPECT_EQ(getNode("rect")->getInvalidations() & InvalidatesBounds,
+            InvalidatesNone);
+  EXPECT_EQ(getNode("path")->getInvalidations(), InvalidatesNone);
+}
+
+TEST_F(InvalidationTest, PaintPropsInvalidatePaint) {
+  EXPECT_EQ(commit("rect.setProp('color', 'blue');", "rect"),
+            InvalidatesPaint);
+  EXPECT_EQ(commit("group.setProp('opacity', 0.5);", "group"),
+            InvalidatesPaint);
+}
+
+TEST_F(InvalidationTest, GeometryPropsInvalidateGeometryAndBounds) {
+  EXPECT_EQ(commit("path.setProp('path', 'M 0 0 L 30 30 L 0 30 Z');", "path"),
+            InvalidatesGeometry | InvalidatesBounds);
+  auto invalidations = commit("rect.setProp('x', 20);", "rect");
+  EXPECT_EQ(invalidations & InvalidatesBounds, InvalidatesBounds);
+  EXPECT_EQ(invalidations & InvalidatesPaint, InvalidatesNone);
+}
+
+TEST_F(InvalidationTest, PropsMissingFromSetPropsAreReset) {
+  bool changed = false;
+  EXPECT_EQ(commit("rect.setProps({ x: 10, y: 10, width: 40, height: 30, "
+                   "color: 'red' });",
+                   "rect", &changed),
+            InvalidatesNone);
+  EXPECT_FALSE(changed);
+  // Set with setProps
+  EXPECT_EQ(commit("rect.setProps({ x: 10, y: 10, width: 40, height: 30 });",
+                   "rect"),
+            InvalidatesPaint);
+  // Set with setProp
+  commit("rect.setProp('opacity', 0.5);", "rect");
+  EXPECT_EQ(commit("rect.setProps({ x: 10, y: 10, width: 40, height: 30 });",
+                   "rect"),
+            InvalidatesPaint);
+  EXPECT_EQ(commit("rect.setProps({ x: 10, y: 10, width: 40, height: 30 });",
+                   "rect", &changed),
+            InvalidatesNone);
+  EXPECT_FALSE(changed);
+}
+
+TEST_F(InvalidationTest, PathsChangedInPlaceInvalidateGeometry) {
+  bool changed = false;
+  EXPECT_EQ(commit("skPath.offset(10, 0);", "shape", &changed),
+            InvalidatesGeometry | InvalidatesBounds);
+  EXPECT_TRUE(changed);
+  // Unchanged paths don't invalidate anything
+  EXPECT_EQ(commit("", "shape", &changed), InvalidatesNone);
+  EXPECT_FALSE(changed);
+}
+
+TEST_F(InvalidationTest, InPlaceChangesSkipOtherNodes) {
+  bool changed = false;
+  EXPECT_EQ(commit("skPath.lineTo(0, 0);", "rect", &changed),
+            InvalidatesNone);
+  EXPECT_FALSE(changed);
+}
+
+TEST_F(InvalidationTest, PathsChangedInPlaceAreRedrawn) {
+  auto provider = makeCanvasProvider();
+  // Until the scene is recorded into a retained picture
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(_renderer->tryRender(provider));
+  }
+
+  eval("skPath.reset(); skPath.moveTo(100, 100); skPath.lineTo(150, 100); "
+       "skPath.lineTo(150, 150); skPath.close();");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+
+  // The same scene with a new path
+  SkPath path;
+  path.moveTo(100, 100);
+  path.lineTo(150, 100);
+  path.lineTo(150, 150);
+  path.close();
+  _runtime->global().setProperty(
+      *_runtime, "skPath",
+      jsi::Object::createFromHostObject(
+          *_runtime, std::make_shared<JsiSkPath>(_context, path)));
+  eval(Scene);
+  auto expected = makeCanvasProvider();
+  {
+    auto reference = makeRenderer(evalNode("root"));
+    ASSERT_TRUE(reference->tryRender(expected));
+  }
+  EXPECT_TRUE(equalPixels(provider->readPixels(), expected->readPixels()));
+}
+
+TEST_F(InvalidationTest, MatrixPropsInvalidateOnlyTheMatrix) {
+  EXPECT_EQ(commit("group.setProp('transform', [{ translateX: 10 }]);",
+                   "group"),
+            InvalidatesMatrix);
+  EXPECT_EQ(commit("group.setProp('origin', { x: 5, y: 5 });", "group"),
+            InvalidatesMatrix);
+  // The geometry of drawing nodes is not resolved again
+  EXPECT_EQ(commit("path.setProp('transform', [{ rotate: 1 }]);", "path"),
+            InvalidatesMatrix);
+}
+
+TEST_F(InvalidationTest, LayerPropsInvalidateOnlyTheLayer) {
+  EXPECT_EQ(commit("group.setProp('layer', true);", "group"),
+            InvalidatesLayer);
+  EXPECT_EQ(commit("group.setProp('rasterize', true);", "group"),
+            InvalidatesLayer);
+}
+
+TEST_F(InvalidationTest, ClipPropsInvalidateNothing) {
+  // Read from the props each time the node is drawn
+  bool changed = false;
+  EXPECT_EQ(commit("group.setProp('clip', { x: 0, y: 0, width: 20, "
+                   "height: 20 });",
+                   "group", &changed),
+            InvalidatesNone);
+  EXPECT_TRUE(changed);
+}
+
+TEST_F(InvalidationTest, MatrixChangesAreRedrawn) {
+  auto provider = makeCanvasProvider();
+  eval("group.setProp('clip', { x: 0, y: 0, width: 40, height: 40 });");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+  eval("group.setProp('origin', { x: 20, y: 20 });"
+       "group.setProp('transform', [{ rotate: 0.5 }, { scale: 2 }]);");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+
+  // The same scene created with the new props
+  eval(Scene);
+  eval("group.setProp('clip', { x: 0, y: 0, width: 40, height: 40 });"
+       "group.setProp('origin', { x: 20, y: 20 });"
+       "group.setProp('transform', [{ rotate: 0.5 }, { scale: 2 }]);");
+  auto expected = makeCanvasProvider();
+  {
+    auto reference = makeRenderer(evalNode("root"));
+    ASSERT_TRUE(reference->tryRender(expected));
+  }
+  EXPECT_TRUE(equalPixels(provider->readPixels(), expected->readPixels()));
+}
+
+TEST_F(InvalidationTest, DeclarationsInvalidateThePaintOfTheirParent) {
+  EXPECT_EQ(commit("rect.addChild(blur);", "rect"), InvalidatesPaint);
+  // Consume it again before changing the declaration
+  ASSERT_TRUE(_renderer->tryRender(makeCanvasProvider()));
+
+  bool changed = false;
+  EXPECT_EQ(commit("blur.setProp('blur', 8);", "blur", &changed),
+            InvalidatesNone);
+  EXPECT_TRUE(changed);
+  EXPECT_EQ(commit("blur.setProp('blur', 2);", "rect"), InvalidatesPaint);
+}
+
+TEST_F(InvalidationTest, ShaderPropsInvalidateTheShader) {
+  EXPECT_EQ(commit("rect.addChild(gradient);", "rect"), InvalidatesPaint);
+  ASSERT_TRUE(_renderer->tryRender(makeCanvasProvider()));
+  EXPECT_EQ(getNode("gradient")->getInvalidations(), InvalidatesNone);
+
+  // The shader is made again, and the paint using it compiled again
+  EXPECT_EQ(commit("gradient.setProp('colors', ['green', 'blue']);",
+                   "gradient"),
+            InvalidatesShader);
+  EXPECT_EQ(commit("gradient.setProp('colors', ['red', 'blue']);", "rect"),
+            InvalidatesPaint);
+  ASSERT_TRUE(_renderer->tryRender(makeCanvasProvider()));
+
+  // Paint changes reuse the shader
+  bool changed = false;
+  EXPECT_EQ(commit("rect.setProp('opacity', 0.5);", "gradient", &changed),
+            InvalidatesNone);
+  EXPECT_FALSE(changed);
+}
+
+TEST_F(InvalidationTest, ShaderChangesAreRedrawn) {
+  auto provider = makeCanvasProvider();
+  eval("rect.addChild(gradient);");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+  eval("gradient.setProp('colors', ['green', 'yellow']);");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+  eval("rect.setProp('opacity', 0.5);");
+  ASSERT_TRUE(_renderer->tryRender(provider));
+
+  // The same scene created with the new props
+  eval(Scene);
+  eval("gradient.setProp('colors', ['green', 'yellow']);"
+       "rect.setProp('opacity', 0.5);"
+       "rect.addChild(gradient);");
+  auto expected = makeCanvasProvider();
+  {
+    auto reference = makeRenderer(evalNode("root"));
+    ASSERT_TRUE(reference->tryRender(expected));
+  }
+  EXPECT_TRUE(equalPixels(provider->readPixels(), expected->readPixels()));
+}
+
+} // namespace RNSkia
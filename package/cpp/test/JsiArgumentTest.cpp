@@ -0,0 +1,106 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "DomTestFixture.h"
+#include "JsiSkCanvas.h"
+#include "JsiSkPaint.h"
+
+namespace RNSkia {
+
+namespace {
+
+/**
+ A canvas with drawCircle unpacking its arguments by hand, as the canvas
+ bindings did before they were bound from their native signatures
+ */
+class HandwrittenCanvas : public JsiSkHostObject {
+public:
+  HandwrittenCanvas(std::shared_ptr<RNSkPlatformContext> context,
+                    SkCanvas *canvas)
+      : JsiSkHostObject(std::move(context)), _canvas(canvas) {}
+
+  JSI_HOST_FUNCTION(drawCircle) {
+    SkScalar cx = arguments[0].asNumber();
+    SkScalar cy = arguments[1].asNumber();
+    SkScalar radius = arguments[2].asNumber();
+
+    auto paint = JsiSkPaint::fromValue(runtime, arguments[3]);
+    _canvas->drawCircle(cx, cy, radius, *paint);
+
+    return jsi::Value::undefined();
+  }
+
+  JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(HandwrittenCanvas, drawCircle))
+
+private:
+  SkCanvas *_canvas;
+};
+
+const char *Scene = R"(
+function drawCircles(canvas, count) {
+  for (var i = 0; i < count; i++) {
+    canvas.drawCircle(i % 256, 128, 8, paint);
+  }
+}
+)";
+
+} // namespace
+
+/**
+ Compares methods bound from their native signatures with handwritten ones,
+ with globals for a bound and a handwritten canvas drawing on the same
+ surface
+ */
+class JsiArgumentTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    _surface = SkSurface::MakeRasterN32Premul(Width, Height);
+    setGlobal("boundCanvas", std::make_shared<JsiSkCanvas>(
+                                 _context, _surface->getCanvas()));
+    setGlobal("handwrittenCanvas", std::make_shared<HandwrittenCanvas>(
+                                       _context, _surface->getCanvas()));
+    setGlobal("paint", std::make_shared<JsiSkPaint>(_context, SkPaint()));
+    eval(Scene);
+  }
+
+  void setGlobal(const std::string &name,
+                 std::shared_ptr<jsi::HostObject> hostObject) {
+    _runtime->global().setProperty(
+        *_runtime, name.c_str(),
+        jsi::Object::createFromHostObject(*_runtime, std::move(hostObject)));
+  }
+
+  sk_sp<SkSurface> _surface;
+};
+
+TEST_F(JsiArgumentTest, ArgumentsOfTheWrongTypeNameTheirIndex) {
+  auto message = eval(R"(
+(function () {
+  try {
+    boundCanvas.drawCircle(0, "0", 8, paint);
+  } catch (e) {
+    return e.message;
+  }
+  return "";
+})()
+)")
+                     .asString(*_runtime)
+                     .utf8(*_runtime);
+  EXPECT_EQ(message, "Expected type number for parameter at index 1");
+}
+
+TEST_F(JsiArgumentTest, CallTime) {
+  // Warm up both, then draw the same circles with each
+  eval("drawCircles(boundCanvas, 1000); drawCircles(handwrittenCanvas, 1000);");
+  auto boundMs = timeMs([&]() { eval("drawCircles(boundCanvas, 250000);"); });
+  auto handwrittenMs =
+      timeMs([&]() { eval("drawCircles(handwrittenCanvas, 250000);"); });
+
+  // 250k calls each
+  reportTiming("boundDrawCircleMs", boundMs);
+  reportTiming("handwrittenDrawCircleMs", handwrittenMs);
+}
+
+} // namespace RNSkia
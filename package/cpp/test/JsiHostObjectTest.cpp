@@ -0,0 +1,114 @@
+#include <memory>
+#include <string>
+
+#include "DomTestFixture.h"
+#include "JsiSkPaint.h"
+#include "JsiSkPath.h"
+
+namespace RNSkia {
+
+/**
+ Property lookups on host objects, with globals for a path and a paint
+ */
+class JsiHostObjectTest : public DomTest {
+protected:
+  void SetUp() override {
+    DomTest::SetUp();
+    setGlobal("skPath", std::make_shared<JsiSkPath>(_context, SkPath()));
+    setGlobal("skPaint", std::make_shared<JsiSkPaint>(_context, SkPaint()));
+  }
+
+  void setGlobal(const std::string &name,
+                 std::shared_ptr<jsi::HostObject> hostObject) {
+    _runtime->global().setProperty(
+        *_runtime, name.c_str(),
+        jsi::Object::createFromHostObject(*_runtime, std::move(hostObject)));
+  }
+};
+
+TEST_F(JsiHostObjectTest, ResolvedNamesStayWithTheirClass) {
+  // Both classes export the same getter name, resolved to different getters
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(eval("skPath.__typename__").asString(*_runtime).utf8(*_runtime),
+              "Path");
+    EXPECT_EQ(eval("skPaint.__typename__").asString(*_runtime).utf8(*_runtime),
+              "Paint");
+  }
+  // Names of one class are not found on the other
+  EXPECT_TRUE(eval("typeof skPath.lineTo === 'function'").getBool());
+  EXPECT_TRUE(eval("skPaint.lineTo === undefined").getBool());
+  EXPECT_TRUE(eval("typeof skPaint.setColor === 'function'").getBool());
+  EXPECT_TRUE(eval("skPath.setColor === undefined").getBool());
+}
+
+TEST_F(JsiHostObjectTest, ResolvedNamesAreReplacedInTurn) {
+  // More names than are remembered, read in a loop
+  eval(R"(
+var names = ["moveTo", "lineTo", "quadTo", "cubicTo", "close", "reset",
+  "offset", "transform", "computeTightBounds", "getBounds", "__typename__"];
+var types = [];
+for (var i = 0; i < 3; i++) {
+  for (var j = 0; j < names.length; j++) {
+    types.push(typeof skPath[names[j]]);
+  }
+}
+)");
+  EXPECT_EQ(eval("types.filter(function (t) { return t === 'function'; })"
+                 ".length")
+                .asNumber(),
+            30);
+  EXPECT_EQ(eval("types.filter(function (t) { return t === 'string'; })"
+                 ".length")
+                .asNumber(),
+            3);
+}
+
+TEST_F(JsiHostObjectTest, FunctionsAreCalledOnTheirThisValue) {
+  // Shared by all paths, so they act on the path they are called on
+  eval("var other = skPath.copy(); skPath.lineTo.call(other, 10, 10);");
+  EXPECT_EQ(eval("other.countPoints()").asNumber(), 2);
+  EXPECT_EQ(eval("skPath.countPoints()").asNumber(), 0);
+  EXPECT_EQ(eval("var bound = skPath.lineTo.bind(skPath); bound(5, 5); "
+                 "skPath.countPoints()")
+                .asNumber(),
+            2);
+
+  // Detached, or called on an object of another class
+  for (std::string call :
+       {"var lineTo = skPath.lineTo; lineTo(0, 0);",
+        "skPath.lineTo.call(undefined, 0, 0);",
+        "skPath.lineTo.call(skPaint, 0, 0);",
+        "skPath.lineTo.call({}, 0, 0);"}) {
+    SCOPED_TRACE(call);
+    auto message = eval("(function () { try { " + call +
+                        " } catch (e) { return e.message; } return ''; })()")
+                       .asString(*_runtime)
+                       .utf8(*_runtime);
+    EXPECT_NE(message.find("invalid this value"), std::string::npos);
+  }
+}
+
+TEST_F(JsiHostObjectTest, LookupTime) {
+  // Repeated names, as in a loop building a path
+  auto repeatedMs = timeMs([&]() {
+    eval(R"(
+for (var i = 0; i < 250000; i++) {
+  skPath.moveTo; skPath.lineTo; skPath.close; skPath.__typename__;
+}
+)");
+  });
+  // Names outside the exported tables are converted to strings each time
+  auto missedMs = timeMs([&]() {
+    eval(R"(
+for (var i = 0; i < 250000; i++) {
+  skPath.foo; skPath.bar; skPath.baz; skPath.qux;
+}
+)");
+  });
+
+  // 1M lookups each
+  reportTiming("hostObjectLookupMs", repeatedMs);
+  reportTiming("hostObjectMissedLookupMs", missedMs);
+}
+
+} // namespace RNSkia
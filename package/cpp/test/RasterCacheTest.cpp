@@ -0,0 +1,85 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "RasterCache.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkSurface.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+namespace {
+
+// Size in bytes of the images made by makeImage
+constexpr size_t ImageBytes = 16 * 16 * 4;
+
+sk_sp<SkImage> makeImage() {
+  return SkSurface::MakeRasterN32Premul(16, 16)->makeImageSnapshot();
+}
+
+} // namespace
+
+TEST(RasterCacheTest, EvictsLeastRecentlyUsedImages) {
+  RasterCache cache;
+  cache.setBudget(2 * ImageBytes);
+
+  RasterCacheEntry a, b, c;
+  a.setImage(&cache, makeImage());
+  b.setImage(&cache, makeImage());
+  EXPECT_NE(a.getImage(&cache), nullptr);
+
+  c.setImage(&cache, makeImage());
+  EXPECT_NE(a.getImage(&cache), nullptr);
+  EXPECT_EQ(b.getImage(&cache), nullptr);
+  EXPECT_NE(c.getImage(&cache), nullptr);
+  EXPECT_EQ(cache.getUsedBytes(), 2 * ImageBytes);
+}
+
+TEST(RasterCacheTest, ReleasesImagesOfClearedEntriesWhenPurged) {
+  RasterCache cache;
+  auto entry = std::make_unique<RasterCacheEntry>();
+  entry->setImage(&cache, makeImage());
+  RasterCacheEntry other;
+  other.setImage(&cache, makeImage());
+
+  // Released entries leave their image to the cache
+  entry = nullptr;
+  other.clear();
+  EXPECT_EQ(cache.getUsedBytes(), 2 * ImageBytes);
+
+  cache.purge();
+  EXPECT_EQ(cache.getUsedBytes(), 0u);
+}
+
+TEST(RasterCacheTest, KeepsImagesOfEachCacheSeparate) {
+  RasterCache cache;
+  RasterCache otherCache;
+  otherCache.setBudget(0);
+
+  RasterCacheEntry entry;
+  entry.setImage(&cache, makeImage());
+  EXPECT_EQ(entry.getImage(&otherCache), nullptr);
+
+  // Going over the budget of one cache doesn't evict images of the other
+  RasterCacheEntry other;
+  other.setImage(&otherCache, makeImage());
+  other.setImage(&otherCache, makeImage());
+  EXPECT_NE(entry.getImage(&cache), nullptr);
+}
+
+TEST(RasterCacheTest, EntriesOutliveTheirCache) {
+  RasterCacheEntry entry;
+  {
+    RasterCache cache;
+    entry.setImage(&cache, makeImage());
+  }
+  RasterCache cache;
+  EXPECT_EQ(entry.getImage(&cache), nullptr);
+}
+
+} // namespace RNSkia
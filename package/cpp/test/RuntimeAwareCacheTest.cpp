@@ -0,0 +1,76 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+
+#include "RuntimeAwareCache.h"
+
+namespace RNJsi {
+
+namespace {
+
+using NameCache = RuntimeAwareCache<std::optional<jsi::Value>>;
+
+/**
+ Returns the name kept by the cache for the runtime, setting it on first use
+ */
+std::string readName(NameCache &cache, jsi::Runtime &runtime,
+                     const std::string &name) {
+  auto &value = cache.get(runtime);
+  if (!value.has_value()) {
+    value = jsi::String::createFromUtf8(runtime, name);
+  }
+  return value->asString(runtime).utf8(runtime);
+}
+
+} // namespace
+
+TEST(RuntimeAwareCacheTest, RuntimesAreTornDownWhileOthersUseTheCache) {
+  // Shared like the export tables of host object classes, and outliving all
+  // of the runtimes
+  NameCache cache(true);
+  {
+    auto mainRuntime = facebook::hermes::makeHermesRuntime();
+    BaseRuntimeAwareCache::setMainJsRuntime(mainRuntime.get());
+    EXPECT_EQ(readName(cache, *mainRuntime, "main"), "main");
+
+    // Secondary runtimes, as worklet runtimes, created and torn down on their
+    // own threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+      threads.emplace_back([&cache, i]() {
+        auto name = "secondary " + std::to_string(i);
+        for (int n = 0; n < 50; n++) {
+          auto runtime = facebook::hermes::makeHermesRuntime();
+          for (int j = 0; j < 100; j++) {
+            EXPECT_EQ(readName(cache, *runtime, name), name);
+          }
+        }
+      });
+    }
+
+    // The main runtime is replaced meanwhile, as when the app is reloaded,
+    // and the previous one torn down after the new one used the cache
+    for (int n = 0; n < 20; n++) {
+      auto runtime = facebook::hermes::makeHermesRuntime();
+      BaseRuntimeAwareCache::setMainJsRuntime(runtime.get());
+      auto name = "main " + std::to_string(n);
+      EXPECT_EQ(readName(cache, *runtime, name), name);
+      mainRuntime = std::move(runtime);
+      EXPECT_EQ(readName(cache, *mainRuntime, name), name);
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  BaseRuntimeAwareCache::setMainJsRuntime(nullptr);
+}
+
+} // namespace RNJsi
@@ -0,0 +1,62 @@
+import { importSkia, width, getSkDOM } from "../../renderer/__tests__/setup";
+import { setupSkia } from "../../skia/__tests__/setup";
+import type { RenderNode } from "../types";
+import { NodeType } from "../types";
+import { JsiDrawingContext } from "../types/DrawingContext";
+
+const size = width;
+
+const draw = (root: RenderNode<unknown>) => {
+  const { Skia } = importSkia();
+  const { surface, canvas } = setupSkia(width, width);
+  root.render(new JsiDrawingContext(Skia, canvas));
+  return surface.makeImageSnapshot().encodeToBytes();
+};
+
+describe("Tree", () => {
+  it("should return the root and the kept nodes in depth-first order", () => {
+    const Sk = getSkDOM();
+    const [root, rect, blur, circle] = Sk.Tree([
+      "GroupNode",
+      {},
+      [
+        [
+          "RectNode",
+          { x: 0, y: 0, width: 10, height: 10 },
+          [["BlurMaskFilterNode", { blur: 4 }, [], true]],
+          true,
+        ],
+        ["CircleNode", { cx: 5, cy: 5, r: 5 }, [], true],
+      ],
+    ]);
+    expect(root.type).toBe(NodeType.Group);
+    expect(root.children().length).toBe(2);
+    expect(rect.type).toBe(NodeType.Rect);
+    expect(rect.children()).toEqual([blur]);
+    expect(blur.type).toBe(NodeType.BlurMaskFilter);
+    expect(circle.type).toBe(NodeType.Circle);
+  });
+  it("should draw like the nodes created one by one", () => {
+    const { Skia } = importSkia();
+    const Sk = getSkDOM();
+    const color = Skia.Color("cyan");
+    const [tree] = Sk.Tree([
+      "GroupNode",
+      { color },
+      [
+        ["FillNode"],
+        ["CircleNode", { cx: size / 2, cy: size / 2, r: size / 4 }],
+      ],
+    ]);
+    const root = Sk.Group({ color });
+    root.addChild(Sk.Fill());
+    root.addChild(Sk.Circle({ cx: size / 2, cy: size / 2, r: size / 4 }));
+    expect(draw(tree as RenderNode<unknown>)).toEqual(draw(root));
+  });
+  it("should reject unknown node types", () => {
+    const Sk = getSkDOM();
+    expect(() =>
+      Sk.Tree(["GroupNode", {}, [["FooNode" as "GroupNode"]]])
+    ).toThrow('Unknown node type "FooNode".');
+  });
+});
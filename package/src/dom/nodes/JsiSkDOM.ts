@@ -39,6 +39,8 @@ import type {
   BoxProps,
   BoxShadowProps,
   ChildrenProps,
+  Node,
+  NodeDescription,
 } from "../types";
 import type {
   BlendImageFilterProps,
@@ -470,4 +472,30 @@ export class JsiSkDOM implements SkDOM {
       ? global.SkiaDomApi.BoxShadowNode(props)
       : new BoxShadowNode(this.ctx, props);
   }
+
+  Tree(description: NodeDescription) {
+    if (NATIVE_DOM) {
+      // Creates all of the nodes in a single call
+      return global.SkiaDomApi.createTree(description);
+    }
+    const kept: Node<unknown>[] = [];
+    const root = this.createNode(description, kept);
+    return [root, ...kept];
+  }
+
+  private createNode(description: NodeDescription, kept: Node<unknown>[]) {
+    const [type, props, children, keep] = description;
+    const create: unknown = type.endsWith("Node")
+      ? this[type.slice(0, -"Node".length) as keyof SkDOM]
+      : undefined;
+    if (typeof create !== "function" || create === this.Tree) {
+      throw new Error(`Unknown node type "${type}".`);
+    }
+    const node: Node<unknown> = create.call(this, props ?? {});
+    if (keep) {
+      kept.push(node);
+    }
+    children?.forEach((child) => node.addChild(this.createNode(child, kept)));
+    return node;
+  }
 }
@@ -85,4 +85,5 @@ export interface GroupProps extends PaintProps, TransformProps {
   clip?: ClipDef;
   invertClip?: boolean;
   layer?: SkPaint | boolean;
+  rasterize?: boolean;
 }
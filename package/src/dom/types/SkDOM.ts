@@ -9,7 +9,7 @@ import type {
   MorphologyImageFilterProps,
   BlendProps,
 } from "./ImageFilters";
-import type { DeclarationNode, RenderNode } from "./Node";
+import type { DeclarationNode, Node, RenderNode } from "./Node";
 import type {
   BlendColorFilterProps,
   MatrixColorFilterProps,
@@ -66,6 +66,18 @@ type NullablePathEffectNode<P> = DeclarationNode<P>;
 
 type DrawingNode<P extends GroupProps> = RenderNode<P>;
 
+// Name of the node constructor of a node type, as in SkiaDomApi
+export type NodeDescriptionType = `${Exclude<keyof SkDOM, "Tree">}Node`;
+
+// Description of a subtree for SkDOM.Tree: the node type, its props, the
+// descriptions of its children and whether the node is returned.
+export type NodeDescription = [
+  type: NodeDescriptionType,
+  props?: object,
+  children?: NodeDescription[],
+  keep?: boolean
+];
+
 export interface SkDOM {
   Layer(props?: ChildrenProps): RenderNode<ChildrenProps>;
   Group(props?: GroupProps): RenderNode<GroupProps>;
@@ -179,4 +191,9 @@ export interface SkDOM {
   BackdropFilter(props: ChildrenProps): RenderNode<ChildrenProps>;
   Box(props: BoxProps): RenderNode<BoxProps>;
   BoxShadow(props: BoxShadowProps): DeclarationNode<BoxShadowProps>;
+
+  // Creates a subtree from a single description. Returns its root followed by
+  // the nodes marked to keep, in depth-first order. Animated props are not
+  // supported.
+  Tree(description: NodeDescription): Node<unknown>[];
 }
@@ -2,6 +2,8 @@ import { NodeType } from "../dom/types";
 import type {
   DeclarationNode,
   FractalNoiseProps,
+  Node,
+  NodeDescription,
   RenderNode,
   CircleProps,
   DrawingNodeProps,
@@ -193,6 +195,9 @@ declare global {
     BoxNode: (prop: BoxProps) => RenderNode<BoxProps>;
     BoxShadowNode: (prop: BoxShadowProps) => DeclarationNode<BoxShadowProps>;
     LayerNode: (prop: ChildrenProps) => RenderNode<ChildrenProps>;
+
+    // Creates a subtree in one call, see SkDOM.Tree
+    createTree: (description: NodeDescription) => Node<unknown>[];
   };
 
   // eslint-disable-next-line @typescript-eslint/no-namespace
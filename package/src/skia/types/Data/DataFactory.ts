@@ -11,6 +11,14 @@ export interface DataFactory {
    * @param bytes An array of bytes representing the data
    */
   fromBytes(bytes: Uint8Array): SkData;
+  /**
+   * Creates a new Data object that uses the memory of a byte array directly
+   * instead of copying it. The bytes must not be modified while the Data
+   * object, or anything created from it such as an image, is still in use.
+   * On the Web this is the same as fromBytes.
+   * @param bytes An array of bytes representing the data
+   */
+  fromBytesNoCopy(bytes: Uint8Array): SkData;
   /**
    * Creates a new Data object from a base64 encoded string.
    * @param base64 A Base64 encoded string representing the data
@@ -23,6 +23,13 @@ export class JsiSkDataFactory extends Host implements DataFactory {
   fromBytes(bytes: Uint8Array) {
     return new JsiSkData(this.CanvasKit, bytes);
   }
+  /**
+   * CanvasKit always copies the bytes into its own memory.
+   * @param bytes An array of bytes representing the data
+   */
+  fromBytesNoCopy(bytes: Uint8Array) {
+    return this.fromBytes(bytes);
+  }
   /**
    * Creates a new Data object from a base64 encoded string.
    * @param base64 A Base64 encoded string representing the data
@@ -3,7 +3,16 @@ import React from "react";
 import { Fill } from "../../renderer/components";
 import { mountCanvas } from "../../renderer/__tests__/setup";
 import { processResult } from "../../__tests__/setup";
-import { Selector } from "../selector";
+import {
+  Binding,
+  InterpolateColorsSelector,
+  InterpolateSelector,
+  Selector,
+} from "../selector";
+import { interpolate, interpolateColors } from "../../animation";
+import { Skia } from "../../skia";
+
+import corpus from "./interpolations.json";
 
 describe("Value Selector", () => {
   it("should accept a selector descriptor as a property with arrays", async () => {
@@ -24,3 +33,81 @@ describe("Value Selector", () => {
     processResult(surface, "snapshots/animations/red.png");
   });
 });
+
+describe("Value Binding", () => {
+  it("should transform the value of the bound value", () => {
+    const value = global.SkiaValueApi.createValue(0.5);
+    const { selector } = Binding(value, { scale: 4, offset: -1 });
+    expect(selector(0.5)).toBe(1);
+    expect(selector(0)).toBe(-1);
+  });
+
+  it("should pick and clamp array elements", () => {
+    const value = global.SkiaValueApi.createValue([0, 0.5]);
+    const { selector } = Binding(value, { index: 1, scale: 4, clamp: [0, 1] });
+    expect(selector([0, 0.5])).toBe(1);
+    expect(selector([0, 0.125])).toBe(0.5);
+    expect(selector([0, -1])).toBe(0);
+  });
+});
+
+// Shared with the native tests in cpp/test, which check that the native
+// evaluation returns the same outputs
+const { inputs, interpolations, colors } = corpus;
+
+describe("Value Interpolation", () => {
+  it("should interpolate numbers like interpolate", () => {
+    const value = global.SkiaValueApi.createValue(0);
+    interpolations.forEach((interpolation) => {
+      const { inputRange, outputRange, outputs } = interpolation;
+      const type = interpolation.type ?? undefined;
+      const { selector, interpolation: descriptor } = InterpolateSelector(
+        value,
+        inputRange,
+        outputRange,
+        type
+      );
+      expect(descriptor.extrapolateLeft).toBe(type ?? "extend");
+      inputs.forEach((x, i) => {
+        expect(interpolate(x, inputRange, outputRange, type)).toBe(outputs[i]);
+        expect(selector(x)).toBe(outputs[i]);
+      });
+    });
+  });
+
+  it("should interpolate arrays element-wise", () => {
+    const value = global.SkiaValueApi.createValue(0);
+    const { selector } = InterpolateSelector(
+      value,
+      [0, 1],
+      [
+        [0, 10],
+        [1, -10],
+      ],
+      "clamp"
+    );
+    expect(selector(0.5)).toEqual([0.5, 0]);
+    expect(selector(2)).toEqual([1, -10]);
+  });
+
+  it("should interpolate colors like interpolateColors", () => {
+    const value = global.SkiaValueApi.createValue(0);
+    const { selector, interpolation } = InterpolateColorsSelector(
+      value,
+      colors.inputRange,
+      colors.colors
+    );
+    expect(interpolation.color).toBe(true);
+    expect(interpolation.outputRange).toEqual(colors.outputRange);
+    colors.colors.forEach((color, i) => {
+      expect(Array.from(Skia.Color(color))).toEqual(colors.outputRange[i]);
+    });
+    inputs.forEach((x, i) => {
+      const expected = new Float32Array(colors.outputs[i]);
+      expect(interpolateColors(x, colors.inputRange, colors.colors)).toEqual(
+        expected
+      );
+      expect(selector(x)).toEqual(expected);
+    });
+  });
+});
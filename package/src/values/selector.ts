@@ -1,3 +1,12 @@
+import type { ExtrapolationType } from "../animation/functions/interpolate";
+import {
+  interpolate,
+  validateInterpolationOptions,
+} from "../animation/functions/interpolate";
+import { interpolateColors } from "../animation/functions/interpolateColors";
+import type { Color } from "../skia/types";
+import { Skia } from "../skia";
+
 import type { SkiaValue } from "./types";
 
 export type SkiaSelector<TReturn, TInput = unknown> = {
@@ -22,3 +31,146 @@ export const Selector = <TInput, TReturn>(
     value,
   };
 };
+
+export type SkiaBinding = {
+  scale?: number;
+  offset?: number;
+  index?: number;
+  clamp?: [number, number];
+};
+
+export type SkiaBindingSelector<TInput> = SkiaSelector<number, TInput> & {
+  binding: SkiaBinding;
+};
+
+/**
+ * Binds a Skia Value to a property through a declarative transform: the element
+ * at index is picked if the value is an array, then numbers are scaled, offset
+ * and clamped. On the native DOM the transform is evaluated natively, so value
+ * changes don't execute any JS.
+ * @param value Dependant value
+ * @param binding Transform from the Skia Value's value to the property value
+ * @returns A selector descriptor with the binding attached
+ */
+export const Binding = <TInput>(
+  value: SkiaValue<TInput>,
+  binding: SkiaBinding
+): SkiaBindingSelector<TInput> => {
+  const { scale = 1, offset = 0, index, clamp } = binding;
+  return {
+    binding,
+    value,
+    selector: (v: TInput) => {
+      const element =
+        index !== undefined && index >= 0
+          ? (v as unknown as ArrayLike<unknown>)[index]
+          : v;
+      if (typeof element !== "number") {
+        return element as number;
+      }
+      const result = element * scale + offset;
+      return clamp ? Math.min(Math.max(result, clamp[0]), clamp[1]) : result;
+    },
+  };
+};
+
+export type SkiaInterpolation = {
+  inputRange: readonly number[];
+  outputRange: readonly number[] | readonly (readonly number[])[];
+  extrapolateLeft: string;
+  extrapolateRight: string;
+  color?: boolean;
+};
+
+export type SkiaInterpolationSelector<TReturn> = SkiaSelector<
+  TReturn,
+  number
+> & {
+  interpolation: SkiaInterpolation;
+};
+
+/**
+ * Interpolates a Skia Value like interpolate. The output range can be numbers
+ * or arrays of numbers that are interpolated element-wise. On the native DOM
+ * the interpolation is evaluated natively with the same results, so value
+ * changes don't execute any JS.
+ * @param value Dependant value
+ * @param inputRange Input range
+ * @param outputRange Output range
+ * @param type Extrapolation
+ * @returns A selector descriptor with the interpolation attached
+ */
+export function InterpolateSelector(
+  value: SkiaValue<number>,
+  inputRange: readonly number[],
+  outputRange: readonly number[],
+  type?: ExtrapolationType
+): SkiaInterpolationSelector<number>;
+export function InterpolateSelector(
+  value: SkiaValue<number>,
+  inputRange: readonly number[],
+  outputRange: readonly (readonly number[])[],
+  type?: ExtrapolationType
+): SkiaInterpolationSelector<number[]>;
+export function InterpolateSelector(
+  value: SkiaValue<number>,
+  inputRange: readonly number[],
+  outputRange: readonly number[] | readonly (readonly number[])[],
+  type?: ExtrapolationType
+): SkiaInterpolationSelector<number | number[]> {
+  const { extrapolateLeft, extrapolateRight } =
+    validateInterpolationOptions(type);
+  const interpolation = {
+    inputRange,
+    outputRange,
+    extrapolateLeft,
+    extrapolateRight,
+  };
+  const [first] = outputRange;
+  if (typeof first === "number") {
+    const output = outputRange as readonly number[];
+    return {
+      interpolation,
+      value,
+      selector: (v: number) => interpolate(v, inputRange, output, type),
+    };
+  }
+  const outputs = outputRange as readonly (readonly number[])[];
+  return {
+    interpolation,
+    value,
+    selector: (v: number) =>
+      first.map((_, i) =>
+        interpolate(
+          v,
+          inputRange,
+          outputs.map((o) => o[i]),
+          type
+        )
+      ),
+  };
+}
+
+/**
+ * Interpolates colors from a Skia Value like interpolateColors, evaluated
+ * natively on the native DOM.
+ * @param value Dependant value
+ * @param inputRange Input range
+ * @param outputRange Colors
+ * @returns A selector descriptor with the interpolation attached
+ */
+export const InterpolateColorsSelector = (
+  value: SkiaValue<number>,
+  inputRange: number[],
+  outputRange: Color[]
+): SkiaInterpolationSelector<Float32Array> => ({
+  interpolation: {
+    inputRange,
+    outputRange: outputRange.map((color) => Array.from(Skia.Color(color))),
+    extrapolateLeft: "clamp",
+    extrapolateRight: "clamp",
+    color: true,
+  },
+  value,
+  selector: (v: number) => interpolateColors(v, inputRange, outputRange),
+});